@@ -0,0 +1,31 @@
+// Adafruit_GFX.h - native stand-in, drawing is discarded
+#ifndef NATIVE_ADAFRUIT_GFX_H
+#define NATIVE_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : width(w), height(h) {}
+  size_t write(uint8_t c) override { (void)c; return 1; }
+  using Print::write;
+
+  void setTextSize(uint8_t size) { (void)size; }
+  void setTextColor(uint16_t color) { (void)color; }
+  void setTextColor(uint16_t color, uint16_t background) { (void)color; (void)background; }
+  void setTextWrap(bool wrap) { (void)wrap; }
+  void setCursor(int16_t x, int16_t y) { (void)x; (void)y; }
+  void cp437(bool on = true) { (void)on; }
+  void drawPixel(int16_t, int16_t, uint16_t) {}
+  void drawLine(int16_t, int16_t, int16_t, int16_t, uint16_t) {}
+  void drawRect(int16_t, int16_t, int16_t, int16_t, uint16_t) {}
+  void fillRect(int16_t, int16_t, int16_t, int16_t, uint16_t) {}
+  void drawCircle(int16_t, int16_t, int16_t, uint16_t) {}
+  void fillCircle(int16_t, int16_t, int16_t, uint16_t) {}
+
+protected:
+  int16_t width;
+  int16_t height;
+};
+
+#endif // NATIVE_ADAFRUIT_GFX_H
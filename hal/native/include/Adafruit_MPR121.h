@@ -0,0 +1,25 @@
+// Adafruit_MPR121.h - native stand-in, touch state comes from simSetTouched()
+#ifndef NATIVE_ADAFRUIT_MPR121_H
+#define NATIVE_ADAFRUIT_MPR121_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define MPR121_I2CADDR_DEFAULT 0x5A
+
+class Adafruit_MPR121 {
+public:
+  bool begin(uint8_t address = MPR121_I2CADDR_DEFAULT, TwoWire *wire = &Wire,
+             uint8_t touchThreshold = 12, uint8_t releaseThreshold = 6, bool autoConfig = false);
+  void setThresholds(uint8_t touch, uint8_t release) { (void)touch; (void)release; }
+  uint16_t touched();
+  uint16_t filteredData(uint8_t channel);
+  uint16_t baselineData(uint8_t channel);
+  uint8_t readRegister8(uint8_t reg) { return registers[reg]; }
+  void writeRegister(uint8_t reg, uint8_t value) { registers[reg] = value; }
+
+private:
+  uint8_t registers[256] = { 0 };
+};
+
+#endif // NATIVE_ADAFRUIT_MPR121_H
@@ -0,0 +1,29 @@
+// Adafruit_NeoPixel.h - native stand-in, pixels are kept in memory
+#ifndef NATIVE_ADAFRUIT_NEOPIXEL_H
+#define NATIVE_ADAFRUIT_NEOPIXEL_H
+
+#include <Arduino.h>
+#include <vector>
+
+#define NEO_RGB     0x06
+#define NEO_GRB     0x52
+#define NEO_KHZ800  0x0000
+
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t count, int16_t pin, uint16_t type) : pixels(count, 0) { (void)pin; (void)type; }
+  void begin() {}
+  void clear() { std::fill(pixels.begin(), pixels.end(), 0); }
+  void show();
+  void setBrightness(uint8_t value) { (void)value; }
+  void setPixelColor(uint16_t index, uint32_t color) { if (index < pixels.size()) pixels[index] = color; }
+  uint32_t getPixelColor(uint16_t index) const { return index < pixels.size() ? pixels[index] : 0; }
+  uint16_t numPixels() const { return (uint16_t)pixels.size(); }
+  bool canShow() const { return true; }
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) { return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b; }
+
+private:
+  std::vector<uint32_t> pixels;
+};
+
+#endif // NATIVE_ADAFRUIT_NEOPIXEL_H
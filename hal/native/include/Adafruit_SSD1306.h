@@ -0,0 +1,32 @@
+// Adafruit_SSD1306.h - native stand-in, the display is always present and blank
+#ifndef NATIVE_ADAFRUIT_SSD1306_H
+#define NATIVE_ADAFRUIT_SSD1306_H
+
+#include <Adafruit_GFX.h>
+#include <Wire.h>
+
+#define SSD1306_BLACK             0
+#define SSD1306_WHITE             1
+#define SSD1306_INVERSE           2
+#define SSD1306_SWITCHCAPVCC      0x02
+#define SSD1306_EXTERNALVCC       0x01
+#define SSD1306_SETCONTRAST       0x81
+#define SSD1306_DISPLAYOFF        0xAE
+#define SSD1306_DISPLAYON         0xAF
+
+class Adafruit_SSD1306 : public Adafruit_GFX {
+public:
+  Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *wire = &Wire, int8_t resetPin = -1)
+    : Adafruit_GFX(w, h) { (void)wire; (void)resetPin; }
+  bool begin(uint8_t vcs = SSD1306_SWITCHCAPVCC, uint8_t address = 0, bool reset = true, bool periphBegin = true) {
+    (void)vcs; (void)address; (void)reset; (void)periphBegin;
+    return true;
+  }
+  void clearDisplay() {}
+  void display() {}
+  void invertDisplay(bool on) { (void)on; }
+  void dim(bool on) { (void)on; }
+  void ssd1306_command(uint8_t command) { (void)command; }
+};
+
+#endif // NATIVE_ADAFRUIT_SSD1306_H
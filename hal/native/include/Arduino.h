@@ -0,0 +1,98 @@
+// Arduino.h - native (Linux) stand-in for the Teensy core, see SimHal.h
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <math.h>
+#include <algorithm>
+#include "Print.h"
+#include "Stream.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH          1
+#define LOW           0
+#define INPUT         0
+#define OUTPUT        1
+#define INPUT_PULLUP  2
+#define RISING        3
+#define FALLING       2
+#define CHANGE        4
+
+#define F_CPU_ACTUAL  600000000UL
+#define DMAMEM
+#define PROGMEM
+#define FLASHMEM
+#define F(text) text
+
+// Cycle counter, counts at F_CPU_ACTUAL from the host clock
+uint32_t halCycleCount();
+#define ARM_DWT_CYCCNT (halCycleCount())
+
+// Writing these does nothing on the host
+extern volatile uint32_t SCB_AIRCR;
+void _reboot_Teensyduino_();
+
+using std::min;
+using std::max;
+
+#define constrain(value, low, high) ((value) < (low) ? (low) : ((value) > (high) ? (high) : (value)))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+long map(long value, long fromLow, long fromHigh, long toLow, long toHigh);
+
+//================================
+// TIME
+//================================
+// Host time plus whatever delay() skipped, delays return immediately
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+//================================
+// GPIO, ADC, PWM
+//================================
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+void analogReadResolution(unsigned int bits);
+void analogReadAveraging(unsigned int samples);
+void analogWriteResolution(unsigned int bits);
+void analogWriteFrequency(uint8_t pin, float frequency);
+int digitalPinToInterrupt(int pin);
+void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode);
+void noInterrupts();
+void interrupts();
+
+//================================
+// SERIAL
+//================================
+// Output goes to stdout, input comes from simSerialInput()
+
+class SerialPort : public Stream {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  operator bool() const { return true; }
+  size_t write(uint8_t b) override;
+  size_t write(const uint8_t *data, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+  void flush() override;
+};
+
+extern SerialPort Serial;
+
+#endif // NATIVE_ARDUINO_H
@@ -0,0 +1,40 @@
+// EEPROM.h - native stand-in for the Teensy EEPROM emulation, kept in RAM
+#ifndef NATIVE_EEPROM_H
+#define NATIVE_EEPROM_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define NATIVE_EEPROM_SIZE 4284   // Teensy 4.1
+
+class EEPROMClass {
+public:
+  EEPROMClass() { memset(bytes, 0xFF, sizeof(bytes)); }
+
+  uint8_t read(int address) const { return valid(address) ? bytes[address] : 0xFF; }
+  void write(int address, uint8_t value) { if (valid(address)) bytes[address] = value; }
+  void update(int address, uint8_t value) { write(address, value); }
+  uint16_t length() const { return NATIVE_EEPROM_SIZE; }
+
+  template <typename T>
+  T &get(int address, T &value) const {
+    if (valid(address) && address + sizeof(T) <= NATIVE_EEPROM_SIZE) memcpy((void *)&value, bytes + address, sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  const T &put(int address, const T &value) {
+    if (valid(address) && address + sizeof(T) <= NATIVE_EEPROM_SIZE) memcpy(bytes + address, (const void *)&value, sizeof(T));
+    return value;
+  }
+
+  uint8_t *data() { return bytes; }   // For SimHal.h
+
+private:
+  static bool valid(int address) { return address >= 0 && address < NATIVE_EEPROM_SIZE; }
+  uint8_t bytes[NATIVE_EEPROM_SIZE];
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // NATIVE_EEPROM_H
@@ -0,0 +1,29 @@
+// IPAddress.h - native stand-in for the Arduino IPAddress class
+#ifndef NATIVE_IP_ADDRESS_H
+#define NATIVE_IP_ADDRESS_H
+
+#include <stdint.h>
+#include "Print.h"
+
+class IPAddress : public Printable {
+public:
+  IPAddress() : octets{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octets{a, b, c, d} {}
+  // Network byte order in memory, like the Teensy core
+  IPAddress(uint32_t address) { memcpy(octets, &address, 4); }
+
+  uint8_t operator[](int index) const { return octets[index]; }
+  uint8_t &operator[](int index) { return octets[index]; }
+  operator uint32_t() const { uint32_t address; memcpy(&address, octets, 4); return address; }
+  bool operator==(const IPAddress &other) const { return memcmp(octets, other.octets, 4) == 0; }
+  bool operator!=(const IPAddress &other) const { return !(*this == other); }
+
+  size_t printTo(Print &p) const override {
+    return p.printf("%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+  }
+
+private:
+  uint8_t octets[4];
+};
+
+#endif // NATIVE_IP_ADDRESS_H
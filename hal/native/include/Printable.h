@@ -0,0 +1,15 @@
+// Printable.h - native stand-in for the Arduino Printable interface
+#ifndef NATIVE_PRINTABLE_H
+#define NATIVE_PRINTABLE_H
+
+#include <stddef.h>
+
+class Print;
+
+class Printable {
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print &p) const = 0;
+};
+
+#endif // NATIVE_PRINTABLE_H
@@ -0,0 +1,120 @@
+// QNEthernet.h - native stand-in for QNEthernet, UDP goes through the
+// simulated network in SimHal.h, TCP peers never connect
+#ifndef NATIVE_QNETHERNET_H
+#define NATIVE_QNETHERNET_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <vector>
+
+namespace qindesign {
+namespace network {
+
+class EthernetUDP : public Print {
+public:
+  bool begin(uint16_t port) { localPort = port; return true; }
+  void stop() { localPort = 0; }
+
+  int parsePacket();
+  const uint8_t *data() const { return rx.data(); }
+  int size() const { return (int)rx.size(); }
+  int available() const { return (int)(rx.size() - rxIndex); }
+  int read() { return rxIndex < rx.size() ? rx[rxIndex++] : -1; }
+  IPAddress remoteIP() const { return rxIP; }
+  uint16_t remotePort() const { return rxPort; }
+
+  int beginPacket(IPAddress ip, uint16_t port);
+  int endPacket();
+  size_t write(uint8_t b) override { tx.push_back(b); return 1; }
+  size_t write(const uint8_t *data, size_t size) override { tx.insert(tx.end(), data, data + size); return size; }
+  using Print::write;
+  bool send(const IPAddress &ip, uint16_t port, const uint8_t *data, size_t size);
+
+private:
+  uint16_t localPort = 0;
+  std::vector<uint8_t> rx;
+  size_t rxIndex = 0;
+  IPAddress rxIP;
+  uint16_t rxPort = 0;
+  std::vector<uint8_t> tx;
+  IPAddress txIP;
+  uint16_t txPort = 0;
+};
+
+class EthernetClient : public Stream {
+public:
+  operator bool() const { return false; }
+  uint8_t connected() const { return 0; }
+  bool connect(IPAddress ip, uint16_t port) { (void)ip; (void)port; return false; }
+  bool connectNoWait(IPAddress ip, uint16_t port) { (void)ip; (void)port; return false; }
+  void setNoDelay(bool on) { (void)on; }
+  void setConnectionTimeout(uint16_t ms) { (void)ms; }
+  IPAddress remoteIP() const { return IPAddress(); }
+  uint16_t remotePort() const { return 0; }
+
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int read(uint8_t *buffer, size_t size) { (void)buffer; (void)size; return 0; }
+  int peek() override { return -1; }
+  size_t write(uint8_t b) override { (void)b; return 0; }
+  size_t write(const uint8_t *data, size_t size) override { (void)data; (void)size; return 0; }
+  using Print::write;
+  int availableForWrite() override { return 0; }
+  void flush() override {}
+  void stop() {}
+  void close() {}
+  void abort() {}
+};
+
+class EthernetServer {
+public:
+  EthernetServer() {}
+  explicit EthernetServer(uint16_t port) { (void)port; }
+  void begin() {}
+  bool begin(uint16_t port) { (void)port; return true; }
+  void end() {}
+  EthernetClient accept() { return EthernetClient(); }
+  EthernetClient available() { return EthernetClient(); }
+};
+
+class EthernetClass {
+public:
+  bool begin();
+  bool begin(const IPAddress &ip, const IPAddress &mask, const IPAddress &gateway);
+  void end() {}
+  bool waitForLocalIP(uint32_t timeout) { (void)timeout; return true; }
+  bool linkState() const { return true; }
+  IPAddress localIP() const { return ip; }
+  IPAddress subnetMask() const { return mask; }
+  IPAddress gatewayIP() const { return gateway; }
+  IPAddress broadcastIP() const;
+
+private:
+  IPAddress ip;
+  IPAddress mask;
+  IPAddress gateway;
+};
+
+extern EthernetClass Ethernet;
+
+// Service announcements go nowhere on the host
+class MDNSClass {
+public:
+  bool begin(const char *hostname) { (void)hostname; return true; }
+  void end() {}
+  bool addService(const char *type, const char *protocol, uint16_t port) {
+    (void)type; (void)protocol; (void)port;
+    return true;
+  }
+  bool removeService(const char *type, const char *protocol, uint16_t port) {
+    (void)type; (void)protocol; (void)port;
+    return true;
+  }
+};
+
+extern MDNSClass MDNS;
+
+}  // namespace network
+}  // namespace qindesign
+
+#endif // NATIVE_QNETHERNET_H
@@ -0,0 +1,78 @@
+// SimHal.h
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+//================================
+// NATIVE HARDWARE SIMULATION
+//================================
+// The native build (env:native) compiles the firmware modules against
+// stand-ins for the Teensy core and libraries in hal/native/include. The
+// modules keep calling analogRead(), Wire, EthernetUDP, EEPROM and the
+// Adafruit drivers, those calls land in the simulated backends below.
+// This header is how a host program drives them.
+
+//================================
+// SIMULATION CONFIGURATION
+//================================
+
+#define SIM_MAX_FADERS        16
+#define SIM_MAX_I2C_SLAVES    8
+#define SIM_FADER_MIN_ADC     8       // Mechanical end stops as ADC readings
+#define SIM_FADER_MAX_ADC     1016
+#define SIM_MOTOR_STALL_PWM   30      // Duty below this does not move the knob
+#define SIM_MOTOR_COUNTS_PER_MS 10.0f // Travel speed at full duty
+#define SIM_ADC_NOISE         1       // +/- counts on every reading
+
+//================================
+// FADERS
+//================================
+// A motorised fader: PWM duty with dir1 HIGH drives the wiper up, with
+// dir2 HIGH down, analogRead() of its pin returns the wiper position.
+
+void simAttachFader(uint8_t analogPin, uint8_t pwmPin, uint8_t dirPin1, uint8_t dirPin2, int startAdc);
+
+// Move the knob by hand, as if someone grabbed it
+void simSetFaderAdc(uint8_t analogPin, int adc);
+int simGetFaderAdc(uint8_t analogPin);
+
+//================================
+// TOUCH
+//================================
+
+void simSetTouched(uint16_t bits);      // One bit per MPR121 electrode
+
+//================================
+// I2C SLAVES
+//================================
+// Called for Wire.requestFrom(), fills up to capacity bytes and returns
+// how many, 0 reads as no answer
+
+typedef int (*SimI2cHandler)(uint8_t address, uint8_t *buffer, int capacity);
+
+void simAttachI2cSlave(uint8_t address, SimI2cHandler handler);
+
+//================================
+// NETWORK
+//================================
+
+// Queue a datagram for the next EthernetUDP::parsePacket() on any socket
+void simUdpInject(const uint8_t *data, size_t size, IPAddress from, uint16_t fromPort);
+
+// Called for every datagram the firmware sends, may be nullptr
+typedef void (*SimUdpSink)(const uint8_t *data, size_t size, IPAddress to, uint16_t toPort);
+void simSetUdpSink(SimUdpSink sink);
+
+uint32_t simUdpSentCount();
+uint32_t simPixelShows();
+
+//================================
+// SERIAL
+//================================
+
+// Text read back by Serial.read(), e.g. "METRICS\n"
+void simSerialInput(const char *text);
+
+#endif // SIM_HAL_H
@@ -0,0 +1,20 @@
+// Stream.h - native stand-in for the Arduino Stream class
+#ifndef NATIVE_STREAM_H
+#define NATIVE_STREAM_H
+
+#include "Print.h"
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  size_t readBytes(uint8_t *buffer, size_t length) {
+    size_t n = 0;
+    while (n < length && available() > 0) buffer[n++] = (uint8_t)read();
+    return n;
+  }
+};
+
+#endif // NATIVE_STREAM_H
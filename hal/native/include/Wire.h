@@ -0,0 +1,36 @@
+// Wire.h - native stand-in for the Teensy I2C driver, slaves are simulated (SimHal.h)
+#ifndef NATIVE_WIRE_H
+#define NATIVE_WIRE_H
+
+#include <Arduino.h>
+
+#define WIRE_BUFFER_SIZE 32
+
+class TwoWire : public Stream {
+public:
+  void begin() {}
+  void end() {}
+  void setClock(uint32_t frequency) { (void)frequency; }
+
+  uint8_t requestFrom(uint8_t address, uint8_t quantity);
+  void beginTransmission(uint8_t address);
+  uint8_t endTransmission(bool sendStop = true);
+
+  size_t write(uint8_t b) override;
+  using Print::write;
+  int available() override { return rxLength - rxIndex; }
+  int read() override { return rxIndex < rxLength ? rxBuffer[rxIndex++] : -1; }
+  int peek() override { return rxIndex < rxLength ? rxBuffer[rxIndex] : -1; }
+
+private:
+  uint8_t rxBuffer[WIRE_BUFFER_SIZE];
+  int rxLength = 0;
+  int rxIndex = 0;
+  uint8_t txAddress = 0;
+  uint8_t txBuffer[WIRE_BUFFER_SIZE];
+  int txLength = 0;
+};
+
+extern TwoWire Wire;
+
+#endif // NATIVE_WIRE_H
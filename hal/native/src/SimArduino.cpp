@@ -0,0 +1,202 @@
+// SimArduino.cpp - clock, GPIO, ADC, motors, Print and Serial for the native build
+
+#include <Arduino.h>
+#include "SimHal.h"
+#include <chrono>
+#include <deque>
+
+//================================
+// TIME
+//================================
+
+volatile uint32_t SCB_AIRCR = 0;
+
+static const auto hostStart = std::chrono::steady_clock::now();
+static uint64_t skippedMicros = 0;   // Time delay() pretended to wait
+
+static uint64_t nowMicros() {
+  auto elapsed = std::chrono::steady_clock::now() - hostStart;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + skippedMicros;
+}
+
+unsigned long millis() { return (unsigned long)(nowMicros() / 1000); }
+unsigned long micros() { return (unsigned long)nowMicros(); }
+void delay(unsigned long ms) { skippedMicros += (uint64_t)ms * 1000; }
+void delayMicroseconds(unsigned int us) { skippedMicros += us; }
+void yield() {}
+
+uint32_t halCycleCount() {
+  auto elapsed = std::chrono::steady_clock::now() - hostStart;
+  uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  return (uint32_t)(ns * (F_CPU_ACTUAL / 1000000) / 1000);
+}
+
+void _reboot_Teensyduino_() {
+  printf("[SIM] reboot requested, exiting\n");
+  exit(0);
+}
+
+long map(long value, long fromLow, long fromHigh, long toLow, long toHigh) {
+  return (value - fromLow) * (toHigh - toLow) / (fromHigh - fromLow) + toLow;
+}
+
+//================================
+// FADER MOTORS
+//================================
+
+struct SimFader {
+  uint8_t analogPin, pwmPin, dirPin1, dirPin2;
+  float position;        // ADC counts
+  uint8_t duty;
+  bool dir1, dir2;
+  uint64_t lastUpdate;   // micros
+};
+
+static SimFader simFaders[SIM_MAX_FADERS];
+static int simFaderCount = 0;
+static uint8_t pinLevels[256];
+static uint32_t noiseState = 12345;
+
+void simAttachFader(uint8_t analogPin, uint8_t pwmPin, uint8_t dirPin1, uint8_t dirPin2, int startAdc) {
+  if (simFaderCount >= SIM_MAX_FADERS) return;
+  SimFader &f = simFaders[simFaderCount++];
+  f = SimFader{ analogPin, pwmPin, dirPin1, dirPin2, (float)startAdc, 0, false, false, nowMicros() };
+}
+
+// Move every motor by what its drive did since the last update
+static void stepFaders() {
+  uint64_t now = nowMicros();
+  for (int i = 0; i < simFaderCount; i++) {
+    SimFader &f = simFaders[i];
+    float ms = (now - f.lastUpdate) / 1000.0f;
+    f.lastUpdate = now;
+    if (f.dir1 == f.dir2 || f.duty < SIM_MOTOR_STALL_PWM) continue;
+
+    float speed = SIM_MOTOR_COUNTS_PER_MS * (f.duty - SIM_MOTOR_STALL_PWM) / (255 - SIM_MOTOR_STALL_PWM);
+    f.position += (f.dir1 ? speed : -speed) * ms;
+    f.position = constrain(f.position, (float)SIM_FADER_MIN_ADC, (float)SIM_FADER_MAX_ADC);
+  }
+}
+
+static SimFader *faderOnPin(uint8_t analogPin) {
+  for (int i = 0; i < simFaderCount; i++) {
+    if (simFaders[i].analogPin == analogPin) return &simFaders[i];
+  }
+  return nullptr;
+}
+
+void simSetFaderAdc(uint8_t analogPin, int adc) {
+  stepFaders();
+  SimFader *f = faderOnPin(analogPin);
+  if (f) f->position = adc;
+}
+
+int simGetFaderAdc(uint8_t analogPin) {
+  stepFaders();
+  SimFader *f = faderOnPin(analogPin);
+  return f ? (int)f->position : 0;
+}
+
+//================================
+// GPIO, ADC, PWM
+//================================
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  stepFaders();
+  pinLevels[pin] = value;
+  for (int i = 0; i < simFaderCount; i++) {
+    SimFader &f = simFaders[i];
+    if (f.dirPin1 == pin) f.dir1 = value;
+    if (f.dirPin2 == pin) f.dir2 = value;
+  }
+}
+
+int digitalRead(uint8_t pin) { return pinLevels[pin]; }
+
+int analogRead(uint8_t pin) {
+  stepFaders();
+  SimFader *f = faderOnPin(pin);
+  if (f == nullptr) return 0;
+
+  noiseState = noiseState * 1103515245 + 12345;
+  int noise = (int)((noiseState >> 16) % (2 * SIM_ADC_NOISE + 1)) - SIM_ADC_NOISE;
+  return constrain((int)f->position + noise, 0, 1023);
+}
+
+void analogWrite(uint8_t pin, int value) {
+  stepFaders();
+  for (int i = 0; i < simFaderCount; i++) {
+    if (simFaders[i].pwmPin == pin) simFaders[i].duty = constrain(value, 0, 255);
+  }
+}
+
+void analogReadResolution(unsigned int bits) { (void)bits; }
+void analogReadAveraging(unsigned int samples) { (void)samples; }
+void analogWriteResolution(unsigned int bits) { (void)bits; }
+void analogWriteFrequency(uint8_t pin, float frequency) { (void)pin; (void)frequency; }
+int digitalPinToInterrupt(int pin) { return pin; }
+void attachInterrupt(uint8_t interrupt, void (*handler)(), int mode) { (void)interrupt; (void)handler; (void)mode; }
+void noInterrupts() {}
+void interrupts() {}
+
+//================================
+// PRINT
+//================================
+
+size_t Print::write(const uint8_t *data, size_t size) {
+  size_t n = 0;
+  while (n < size && write(data[n])) n++;
+  return n;
+}
+
+size_t Print::print(long value, int base) {
+  if (base == DEC) return printf("%ld", value);
+  return print((unsigned long)value, base);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  return printf(base == HEX ? "%lX" : "%lu", value);
+}
+
+size_t Print::print(double value, int digits) {
+  return printf("%.*f", digits, value);
+}
+
+size_t Print::printf(const char *format, ...) {
+  char buffer[512];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (length < 0) return 0;
+  return write((const uint8_t *)buffer, std::min((size_t)length, sizeof(buffer) - 1));
+}
+
+//================================
+// SERIAL
+//================================
+
+SerialPort Serial;
+static std::deque<uint8_t> serialInput;
+
+size_t SerialPort::write(uint8_t b) { return fwrite(&b, 1, 1, stdout); }
+size_t SerialPort::write(const uint8_t *data, size_t size) { return fwrite(data, 1, size, stdout); }
+int SerialPort::available() { return (int)serialInput.size(); }
+void SerialPort::flush() { fflush(stdout); }
+
+int SerialPort::read() {
+  if (serialInput.empty()) return -1;
+  int c = serialInput.front();
+  serialInput.pop_front();
+  return c;
+}
+
+int SerialPort::peek() {
+  return serialInput.empty() ? -1 : serialInput.front();
+}
+
+void simSerialInput(const char *text) {
+  while (*text) serialInput.push_back((uint8_t)*text++);
+}
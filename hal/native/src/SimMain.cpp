@@ -0,0 +1,211 @@
+// SimMain.cpp - native entry point
+//
+// Boots the firmware modules against the simulated hardware (SimHal.h),
+// plays a console that sends /faderUpdate bundles and a hand that touches
+// and moves a fader now and then, runs the same task table as the Teensy
+// minus the web server, then prints the metrics, latency and profile
+// reports. Usage:
+//
+//   .pio/build/native/program [seconds] [console updates per second] [--calibrate]
+//
+// --calibrate boots with a blank EEPROM so the calibration job runs
+// against the simulated motors (slow, it waits for them in real time).
+
+#include "SimHal.h"
+#include "Config.h"
+#include "EEPROMStorage.h"
+#include "FaderControl.h"
+#include "TouchSensor.h"
+#include "NetworkOSC.h"
+#include "NeoPixelControl.h"
+#include "i2cPolling.h"
+#include "OSCWriter.h"
+#include "OLED.h"
+#include "Utils.h"
+#include "Metrics.h"
+#include "LatencyStats.h"
+#include "Scheduler.h"
+#include "Profiler.h"
+#include "Arena.h"
+#include <QNEthernet.h>
+
+using namespace qindesign::network;
+
+void updateBrightnessOnFaderTouchChange();   // NeoPixelControl.cpp, declared in main.cpp too
+
+//================================
+// FIRMWARE GLOBALS FROM main.cpp
+//================================
+
+OLED display;
+IPAddress currentIP;
+
+void displayIPAddress() {
+  display.clear();
+  currentIP = Ethernet.localIP();
+  display.showIPAddress(currentIP, netConfig.receivePort, netConfig.sendToIP, netConfig.sendPort);
+}
+
+void displayShowResetHeader() {
+  display.showHeader("Network Reset");
+}
+
+// Unit tests (pio test -e native) bring their own main() and only need the
+// globals above
+#ifndef PIO_UNIT_TESTING
+
+//================================
+// SIMULATED CONSOLE
+//================================
+
+static uint8_t consoleBuffer[1024];
+static uint32_t consoleUpdates = 0;
+
+// One /faderUpdate for page 1: ten values sweeping as sines, ten colors
+static void sendConsoleUpdate(float seconds) {
+  OscWriter w(consoleBuffer, sizeof(consoleBuffer));
+  w.beginMessage("/faderUpdate", ",iiiiiiiiiiissssssssss");
+  w.addInt(1);
+  for (int i = 0; i < 10; i++) {
+    w.addInt((int)(50 + 45 * sinf(seconds * 0.5f + i * 0.6f)));
+  }
+  for (int i = 0; i < 10; i++) {
+    w.addString("255;0;0;255;0;0;255;255");
+  }
+  w.endMessage();
+
+  simUdpInject(w.data(), w.size(), netConfig.sendToIP, netConfig.sendPort);
+  consoleUpdates++;
+}
+
+// Every 3 s the first fader is held for a second and pushed up by hand
+static void simulateHand(unsigned long ms) {
+  bool holding = ms % 3000 < 1000;
+  simSetTouched(holding ? 0x0001 : 0x0000);
+  if (holding) {
+    int adc = SIM_FADER_MIN_ADC + (int)((ms % 1000) * (SIM_FADER_MAX_ADC - SIM_FADER_MIN_ADC) / 1000);
+    simSetFaderAdc(faders[0].analogPin, adc);
+  }
+}
+
+//================================
+// BOOT
+//================================
+
+// Known good calibration so boot does not wait for the motors
+static void seedCalibration() {
+  for (int i = 0; i < NUM_FADERS; i++) {
+    faders[i].minVal = SIM_FADER_MIN_ADC + 10;
+    faders[i].maxVal = SIM_FADER_MAX_ADC - 10;
+  }
+  saveCalibration();
+  saveTouchConfig();
+}
+
+static void oscFlushTask() {
+  flushOscOutput();
+}
+
+static void touchTask() {
+  if (processTouchChanges()) {
+    updateBrightnessOnFaderTouchChange();
+    printFaderTouchStates();
+  }
+}
+
+static void setupSimulation(bool calibrate) {
+  initializeFaders();
+  configureFaderPins();
+  for (int i = 0; i < NUM_FADERS; i++) {
+    simAttachFader(ANALOG_PINS[i], PWM_PINS[i], DIR_PINS1[i], DIR_PINS2[i],
+                   (SIM_FADER_MIN_ADC + SIM_FADER_MAX_ADC) / 2);
+  }
+
+  setupTouch();
+  if (!calibrate) seedCalibration();
+  recoverConfigJournal();
+  checkCalibration();
+  loadAllConfig();
+  setupI2cPolling();
+  display.setupOLED();
+  setupNetwork();
+  setupOscRoutes();
+  displayIPAddress();
+  setupNeoPixels();
+
+  // Same table as main.cpp, without the web server
+  addTask("osc_receive",  handleOscMessage,     0,         TASK_CRITICAL, 1000);
+  addTask("faders",       handleFaders,         0,         TASK_CRITICAL, 500);
+  addTask("calibration",  serviceCalibration,   0,         TASK_CRITICAL, 200);
+  addTask("touch",        touchTask,            0,         TASK_CRITICAL, 500);
+  addTask("keys",         handleI2c,            0,         TASK_CRITICAL, 1000);
+  addTask("osc_flush",    oscFlushTask,         0,         TASK_CRITICAL, 500);
+  addTask("leds",         updateNeoPixels,      16000,     TASK_NORMAL,   1500);
+  addTask("serial",       checkSerialForReboot, 10000,     TASK_LOW,      200);
+  addTask("oled",         updateMetricsDisplay, 100000,    TASK_LOW,      30000);
+
+  heapMarkBoot();
+}
+
+//================================
+// MAIN
+//================================
+
+int main(int argc, char **argv) {
+  float seconds = 5;
+  float updateHz = 50;
+  bool calibrate = false;
+  int positional = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--calibrate") == 0) {
+      calibrate = true;
+    } else if (positional++ == 0) {
+      seconds = atof(argv[i]);
+    } else {
+      updateHz = atof(argv[i]);
+    }
+  }
+
+  setupSimulation(calibrate);
+  resetMetrics();
+  resetLatencyStats();
+  resetProfiler();
+  printf("[SIM] running %.1f s, console at %.0f updates/s\n", seconds, updateHz);
+
+  unsigned long start = millis();
+  unsigned long nextUpdate = start;
+  unsigned long updateMs = updateHz > 0 ? (unsigned long)(1000 / updateHz) : 0;
+  uint32_t passes = 0;
+
+  while (millis() - start < (unsigned long)(seconds * 1000)) {
+    unsigned long now = millis();
+    if (updateMs && now >= nextUpdate) {
+      sendConsoleUpdate((now - start) / 1000.0f);
+      nextUpdate += updateMs;
+    }
+    simulateHand(now - start);
+
+    uint32_t loopStart = ARM_DWT_CYCCNT;
+    {
+      PROFILE_ZONE("loop");
+      runScheduler();
+    }
+    metricsRecordTiming(TIMING_LOOP, ARM_DWT_CYCCNT - loopStart);
+    passes++;
+  }
+
+  printf("\n[SIM] %lu loop passes, %lu console updates, %lu datagrams sent, %lu LED frames\n",
+         (unsigned long)passes, (unsigned long)consoleUpdates,
+         (unsigned long)simUdpSentCount(), (unsigned long)simPixelShows());
+  for (int i = 0; i < NUM_FADERS; i++) {
+    printf("[SIM] fader %d setpoint %d position %d (adc %d)\n", i, (int)faders[i].setpoint,
+           readFadertoOSC(faders[i]), simGetFaderAdc(faders[i].analogPin));
+  }
+  printf("\n");
+  printMetrics(Serial);
+  printLatencyStats(Serial);
+  printProfile(Serial);
+  return 0;
+}
+
+#endif // PIO_UNIT_TESTING
@@ -0,0 +1,177 @@
+// SimPeripherals.cpp - I2C, EEPROM, network, touch and LED backends for the native build
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <EEPROM.h>
+#include <QNEthernet.h>
+#include <Adafruit_MPR121.h>
+#include <Adafruit_NeoPixel.h>
+#include "SimHal.h"
+#include <deque>
+#include <vector>
+
+using namespace qindesign::network;
+
+//================================
+// I2C
+//================================
+
+TwoWire Wire;
+
+struct SimI2cSlave {
+  uint8_t address;
+  SimI2cHandler handler;
+};
+
+static SimI2cSlave i2cSlaves[SIM_MAX_I2C_SLAVES];
+static int i2cSlaveCount = 0;
+
+void simAttachI2cSlave(uint8_t address, SimI2cHandler handler) {
+  if (i2cSlaveCount < SIM_MAX_I2C_SLAVES) i2cSlaves[i2cSlaveCount++] = { address, handler };
+}
+
+static SimI2cSlave *findSlave(uint8_t address) {
+  for (int i = 0; i < i2cSlaveCount; i++) {
+    if (i2cSlaves[i].address == address) return &i2cSlaves[i];
+  }
+  return nullptr;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t quantity) {
+  rxIndex = 0;
+  rxLength = 0;
+  SimI2cSlave *slave = findSlave(address);
+  if (slave) {
+    int capacity = std::min((int)quantity, WIRE_BUFFER_SIZE);
+    rxLength = constrain(slave->handler(address, rxBuffer, capacity), 0, capacity);
+  }
+  return rxLength;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  txAddress = address;
+  txLength = 0;
+}
+
+size_t TwoWire::write(uint8_t b) {
+  if (txLength >= WIRE_BUFFER_SIZE) return 0;
+  txBuffer[txLength++] = b;
+  return 1;
+}
+
+// Writes are accepted and dropped, an absent slave NACKs its address
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  (void)sendStop;
+  return findSlave(txAddress) ? 0 : 2;
+}
+
+//================================
+// EEPROM
+//================================
+
+EEPROMClass EEPROM;
+
+//================================
+// NETWORK
+//================================
+
+EthernetClass qindesign::network::Ethernet;
+MDNSClass qindesign::network::MDNS;
+
+struct SimDatagram {
+  std::vector<uint8_t> data;
+  IPAddress from;
+  uint16_t fromPort;
+};
+
+static std::deque<SimDatagram> udpInbox;
+static SimUdpSink udpSink = nullptr;
+static uint32_t udpSent = 0;
+
+void simUdpInject(const uint8_t *data, size_t size, IPAddress from, uint16_t fromPort) {
+  udpInbox.push_back({ std::vector<uint8_t>(data, data + size), from, fromPort });
+}
+
+void simSetUdpSink(SimUdpSink sink) { udpSink = sink; }
+uint32_t simUdpSentCount() { return udpSent; }
+
+int EthernetUDP::parsePacket() {
+  if (localPort == 0 || udpInbox.empty()) return -1;
+  SimDatagram &d = udpInbox.front();
+  rx.swap(d.data);
+  rxIP = d.from;
+  rxPort = d.fromPort;
+  rxIndex = 0;
+  udpInbox.pop_front();
+  return (int)rx.size();
+}
+
+int EthernetUDP::beginPacket(IPAddress ip, uint16_t port) {
+  tx.clear();
+  txIP = ip;
+  txPort = port;
+  return 1;
+}
+
+int EthernetUDP::endPacket() {
+  bool sent = send(txIP, txPort, tx.data(), tx.size());
+  tx.clear();
+  return sent ? 1 : 0;
+}
+
+bool EthernetUDP::send(const IPAddress &ip, uint16_t port, const uint8_t *data, size_t size) {
+  udpSent++;
+  if (udpSink) udpSink(data, size, ip, port);
+  return true;
+}
+
+// DHCP always answers with the simulated address
+bool EthernetClass::begin() {
+  return begin(IPAddress(192, 168, 1, 50), IPAddress(255, 255, 255, 0), IPAddress(192, 168, 1, 1));
+}
+
+bool EthernetClass::begin(const IPAddress &address, const IPAddress &subnet, const IPAddress &gw) {
+  ip = address;
+  mask = subnet;
+  gateway = gw;
+  return true;
+}
+
+IPAddress EthernetClass::broadcastIP() const {
+  return IPAddress((uint32_t)ip | ~(uint32_t)mask);
+}
+
+//================================
+// TOUCH
+//================================
+
+static uint16_t touchBits = 0;
+
+void simSetTouched(uint16_t bits) { touchBits = bits; }
+
+bool Adafruit_MPR121::begin(uint8_t address, TwoWire *wire, uint8_t touchThreshold,
+                            uint8_t releaseThreshold, bool autoConfig) {
+  (void)address; (void)wire; (void)touchThreshold; (void)releaseThreshold; (void)autoConfig;
+  return true;
+}
+
+uint16_t Adafruit_MPR121::touched() { return touchBits; }
+
+// Touching pulls the filtered reading well under the baseline
+uint16_t Adafruit_MPR121::filteredData(uint8_t channel) {
+  return (touchBits & (1 << channel)) ? 150 : 200;
+}
+
+uint16_t Adafruit_MPR121::baselineData(uint8_t channel) {
+  (void)channel;
+  return 200;
+}
+
+//================================
+// LEDS
+//================================
+
+static uint32_t pixelShows = 0;
+
+void Adafruit_NeoPixel::show() { pixelShows++; }
+uint32_t simPixelShows() { return pixelShows; }
@@ -0,0 +1,60 @@
+// Arena.h
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <Arduino.h>
+
+//================================
+// ARENA CONFIGURATION
+//================================
+
+#define ARENA_MAX_REGISTERED  4    // Arenas listed in the heap report
+
+//================================
+// ARENA ALLOCATOR
+//================================
+// Bump allocator over a static buffer, for scratch memory that lives as
+// long as one web request or one task run. Allocating is a pointer bump,
+// freeing is resetting the whole arena (or rolling back to a mark), so
+// nothing ever reaches the heap and nothing fragments. A request that
+// does not fit gets nullptr and is counted as a failure.
+
+struct Arena {
+  const char *name;
+  uint8_t *base;
+  size_t capacity;
+  size_t used;
+  size_t highWater;         // Most ever in use, sizes the buffer
+  uint32_t failures;        // Allocations that did not fit
+};
+
+// Also registers the arena for printArenaReport()
+void arenaInit(Arena &arena, const char *name, void *buffer, size_t capacity);
+
+void *arenaAlloc(Arena &arena, size_t size, size_t align = alignof(max_align_t));
+char *arenaCopyString(Arena &arena, const char *text, size_t length);
+
+void arenaReset(Arena &arena);
+
+// Nested scopes: take a mark, allocate, roll back to it
+inline size_t arenaMark(const Arena &arena) { return arena.used; }
+void arenaRelease(Arena &arena, size_t mark);
+
+// Zeroed array of a plain struct type
+template <typename T>
+T *arenaAllocArray(Arena &arena, size_t count = 1) {
+  T *items = (T *)arenaAlloc(arena, sizeof(T) * count, alignof(T));
+  if (items) memset((void *)items, 0, sizeof(T) * count);
+  return items;
+}
+
+//================================
+// HEAP REPORT
+//================================
+// Call heapMarkBoot() at the end of setup(). After that the heap should
+// not grow, heap_growth_since_boot in the report proves it.
+
+void heapMarkBoot();
+void printHeapReport(Print &out);
+
+#endif // ARENA_H
@@ -4,7 +4,6 @@
 
 #include <Arduino.h>
 #include <IPAddress.h>
-#include <PID_v1.h>
 
 //================================
 // HARDWARE CONFIGURATION
@@ -23,14 +22,52 @@
 #define TARGET_TOLERANCE 1      // OSC VALUE How close (in analog units) fader must be to setpoint to consider "done"
 #define SEND_TOLERANCE   2       // Also osc value now
 
+// Fader motion
+#define FADER_MOTION_STEP_US     1000   // Time between position checks while faders move
+#define FADER_MOTION_TIMEOUT_MS  2000   // Motors are stopped when a move takes longer than this
+
 // Calibration settings
 #define PLATEAU_THRESH   2       // Threshold (analog delta) to consider that the fader has stopped moving
 #define PLATEAU_COUNT    10      // How many stable readings in a row needed to "lock in" max or min during calibration
+#define CALIBRATION_TIMEOUT_MS  2000   // Per end, the default is used when no plateau is found in time
+#define CALIBRATION_SAMPLE_MS   10     // Time between plateau readings
+#define CALIBRATION_SETTLE_MS   500    // Motor off between finding max and min
+#define CALIBRATION_OLED_MS     250    // OLED progress refresh while calibrating
 
 
 // OSC settings
 #define OSC_VALUE_THRESHOLD 2    // Minimum value change to send OSC update
-#define OSC_RATE_LIMIT     20    // Minimum ms between OSC messages
+#define OSC_RATE_LIMIT     20    // Per fader: one OSC send token refills every this many ms
+#define OSC_RATE_BURST     2     // Per fader: tokens that can be saved up for a quick burst
+#define OSC_TX_BUFFER_SIZE 1400  // Outgoing OSC packet buffer, also the bundle size cap (fits one Ethernet frame)
+#define OSC_ID_LOOKUP_SIZE 1000  // Executor IDs 0-999 resolve to a fader in one table read
+#define OSC_RX_MAX_PACKETS 16    // Max UDP packets drained per loop() pass
+#define OSC_RX_BUDGET_US   2000  // Max time (us) spent draining OSC per loop() pass
+#define OSC_DELTA_FULL_MASK 0x3FF // /faderDelta mask with all ten faders (201-210) set
+
+// Encoder OSC coalescing
+#define ENCODER_COALESCE_MS   0       // Sum encoder steps this long before sending (0 = once per I2C poll cycle)
+#define ENCODER_ACCEL_PERCENT 0       // Acceleration: each event adds v*(v-1)*percent/100 extra steps (0 = linear)
+#define ENCODER_MAX_STEPS     1000    // Clamp for the summed steps sent in one message
+
+// OSC output batching
+#define OSC_BATCH_OUTPUT       1      // 1 = send each tick's messages as one #bundle, 0 = one datagram per message
+#define OSC_BATCH_WINDOW_MS    0      // Hold the bundle this long after its first message (0 = flush every loop tick)
+#define OSC_BATCH_MSG_RESERVE  64     // Flush early when less than this many bytes remain
+
+// OSC over TCP (OSC 1.1 SLIP framing)
+#define OSC_TCP_LISTEN         1      // Also accept OSC over TCP on the receive port
+#define OSC_TCP_MAX_CLIENTS    2      // Inbound TCP connections served at once
+#define OSC_TCP_RETRY_MS       2000   // Reconnect interval for TCP destinations
+#define OSC_TCP_RX_BUDGET      4096   // Max bytes read from all TCP links per loop() pass
+#define OSC_SLIP_MAX_FRAME     1536   // Largest OSC packet accepted over TCP
+
+// OSC bundle settings
+#define OSC_BUNDLE_MAX_DEPTH   4      // Max nesting of #bundle inside #bundle
+#define OSC_SCHED_SLOTS        8      // Timetagged messages that can wait for their time
+#define OSC_SCHED_MSG_MAX      512    // Largest message (bytes) the scheduler can hold
+#define OSC_SCHED_MAX_DELAY_MS 1000   // Timetags further ahead than this are applied immediately
+#define OSC_CLOCK_WINDOW_MS    10000  // Window for re-learning the sender clock offset
 
 // NeoPixel configuration
 #define NEOPIXEL_PIN 12
@@ -79,6 +116,19 @@ struct NetworkConfig {
   uint16_t  receivePort;  // OSC listening port (e.g. 8000)
   uint16_t  sendPort;     // OSC destination port (e.g. 9000)
   bool      useDHCP;      // If true, use DHCP instead of static IP
+  bool      sendTcp;      // Send to the console over TCP (SLIP framed) instead of UDP
+};
+
+// Extra OSC destinations, every outgoing packet is also sent to these
+// (e.g. a backup console or a visualizer). The main console stays in netConfig.
+#define OSC_MAX_DESTINATIONS 4
+
+struct OscDestination {
+  IPAddress ip;           // Destination IP address (ignored when broadcast)
+  uint16_t  port;         // Destination port
+  bool      enabled;      // Send to this destination
+  bool      broadcast;    // Send to the local subnet broadcast address instead of ip
+  bool      tcp;          // Send over TCP (SLIP framed) instead of UDP, not with broadcast
 };
 
 //================================
@@ -119,9 +169,9 @@ struct Fader {
   int maxVal;               // Calibrated analog max
 
   double setpoint;          // Target position
-  double current;           // Current analog reading
+  double current;           // Last analog reading (kept by readFadertoOSC)
 
-  double motorOutput;       // PID output
+  double motorOutput;       // PWM last applied, negative when moving down
   double lastMotorOutput;   // Last motor output for velocity limiting
 
 
@@ -129,7 +179,11 @@ struct Fader {
   unsigned long lastMoveTime; // Time of last movement
   unsigned long lastOscSendTime; // Time of last OSC message
   int lastSentOscValue;     // Last value sent via OSC
+  float oscTokens;          // Rate limiter token bucket (0..OSC_RATE_BURST)
+  unsigned long oscTokenTime; // Last time the bucket was refilled
+  int pendingOscValue;      // Newest value held back by the rate limiter, -1 if none
   bool suppressOSCOut;     // Suppress OSC out or Not
+  bool calibrating;        // Being calibrated, motion and touch handling leave it alone
   uint16_t oscID;           // OSC ID like 201 for /Page2/Fader201
   
 
@@ -150,6 +204,9 @@ struct Fader {
   unsigned long touchStartTime; // When the fader was touched
   unsigned long touchDuration;  // How long the fader has been touched
   unsigned long releaseTime;    // When the fader was last released
+  unsigned long touchStartMicros; // Touch time for the touch -> OSC latency histogram
+  bool touchLatencyPending;     // Touched, no value queued for the console yet
+  bool touchLatencyQueued;      // First value queued, recorded when its packet goes out
 };
 
 //================================
@@ -161,6 +218,7 @@ extern Fader faders[NUM_FADERS];
 
 // Configuration instances
 extern NetworkConfig netConfig;
+extern OscDestination oscDestinations[OSC_MAX_DESTINATIONS];
 extern FaderConfig Fconfig;
 
 // Page tracking
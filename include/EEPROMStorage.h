@@ -14,13 +14,22 @@
 #define FADERCFG_EEPROM_SIGNATURE 0xB5    // Signature for fader configuration
 #define NETCFG_EEPROM_SIGNATURE 0x5B    // Signature for network config
 #define TOUCHCFG_EEPROM_SIGNATURE 0xC7     // Signature for touch sensor configuration
+#define OSCDEST_EEPROM_SIGNATURE 0xD3     // Signature for extra OSC destinations
+#define JOURNAL_EEPROM_SIGNATURE 0xE9     // Set while a multi-section save is in progress
 
 // EEPROM address map with defined layout to ensure organized storage
 #define EEPROM_CAL_START 0              // Start of calibration section (original location)
 #define NETCFG_EEPROM_ADDR 100          // Network config (keeping original address)
 #define EEPROM_CONFIG_START 200         // Start of fader config section
 #define EEPROM_TOUCH_START 400          // Start of touch config
-#define EEPROM_RESERVED_START 500       // Reserved for future expansion
+#define EEPROM_OSCDEST_START 500        // Extra OSC destinations (1 + 8 bytes each)
+#define EEPROM_JOURNAL_START 600        // Undo copy of everything below it during a bulk save
+#define EEPROM_RESERVED_START 1201      // Reserved for future expansion
+
+// EEPROM layout for the save journal (marker, then bytes 0..EEPROM_JOURNAL_START-1)
+#define EEPROM_JOURNAL_MARKER_ADDR EEPROM_JOURNAL_START
+#define EEPROM_JOURNAL_DATA_ADDR (EEPROM_JOURNAL_MARKER_ADDR + 1)
+#define EEPROM_JOURNAL_SIZE EEPROM_JOURNAL_START
 
 // EEPROM layout for calibration data
 #define EEPROM_CAL_SIGNATURE_ADDR EEPROM_CAL_START
@@ -55,10 +64,20 @@ bool loadNetworkConfig();
 void saveTouchConfig();
 void loadTouchConfig();
 
+// Extra OSC destination functions
+void saveOscDestinations();
+void loadOscDestinations();
+
 // Combined configuration functions
 void loadAllConfig();
 void saveAllConfig();
 
+// Multi-section saves: begin, save the sections, then commit. A save cut
+// short by a power loss is rolled back by recoverConfigJournal() at boot.
+void beginConfigJournal();
+void commitConfigJournal();
+void recoverConfigJournal();
+
 // Reset functions
 void resetToDefaults();
 void resetNetworkDefaults();
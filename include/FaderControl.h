@@ -9,7 +9,7 @@
 // Fader initialization
 void initializeFaders();
 void configureFaderPins();
-void calibrateFaders();
+void calibrateFaders();   // Blocking, runs the calibration job to the end
 
 // Main fader processing
 void handleFaders();
@@ -20,7 +20,59 @@ void driveMotor(Fader& f, int direction);
 
 void setFaderSetpoint(int faderIndex, int oscValue);
 int readFadertoOSC(Fader& f);
+int analogToOSC(int analogValue, int minVal, int maxVal);
 
-void moveAllFadersToSetpoints();
+void moveAllFadersToSetpoints();   // Starts a move, returns right away
+void serviceFaderMotion();         // Steps the move, called by handleFaders()
+bool faderMotionActive();
+
+//================================
+// CALIBRATION JOB
+//================================
+// Calibration runs one fader at a time from loop(), the faders it has not
+// reached yet keep following OSC. Calibrated ones hold still until the run
+// ends, then the new ranges are applied and saved once and any console
+// value that came in for them meanwhile is applied. A cancelled run keeps
+// the previous calibration.
+
+enum CalibrationPhase : uint8_t {
+  CAL_IDLE,
+  CAL_FIND_MAX,     // Driving up until the reading plateaus
+  CAL_SETTLE,       // Motor off between max and min
+  CAL_FIND_MIN      // Driving down until the reading plateaus
+};
+
+enum CalibrationOutcome : uint8_t {
+  CAL_PENDING,
+  CAL_RUNNING,
+  CAL_OK,
+  CAL_TIMEOUT,      // An end did not plateau in time, its default was used
+  CAL_INVALID       // Range too small, defaults used
+};
+
+struct CalibrationJob {
+  CalibrationPhase phase;
+  int fader;                      // Fader being calibrated
+  unsigned long phaseStart;
+  unsigned long lastSample;
+  int lastReading;
+  int plateau;                    // Stable readings in a row
+  bool cancelled;                 // Last run was cancelled
+  bool finished;                  // Last run completed
+  uint8_t outcome[NUM_FADERS];    // CalibrationOutcome per fader
+  int minVal[NUM_FADERS];         // Staged until the run completes
+  int maxVal[NUM_FADERS];
+  int heldSetpoint[NUM_FADERS];   // Console value a held fader goes back to, -1 if not held
+};
+
+bool startCalibration();          // false if a run is already going
+void cancelCalibration();
+void serviceCalibration();        // Call from loop()
+bool calibrationRunning();
+bool calibrationHoldSetpoint(int faderIndex, int oscValue);   // false if the job does not hold that fader
+uint8_t calibrationProgress();    // 0-100
+const CalibrationJob &getCalibrationJob();
+const char *calibrationPhaseName(CalibrationPhase phase);
+const char *calibrationOutcomeName(CalibrationOutcome outcome);
 
 #endif // FADER_CONTROL_H
\ No newline at end of file
@@ -0,0 +1,71 @@
+// FixedString.h
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+//================================
+// FIXED STRING
+//================================
+// A Print into an inline char buffer, for the short text the web, config
+// and OLED code used to build with String. Never allocates: output past
+// the capacity is dropped and flagged, the text stays null terminated.
+//
+//   FixedString<24> line;
+//   line.printf("F%d %d%%", fader, progress);
+//   display.showStatus(line.c_str());
+
+template <size_t N>
+class FixedString : public Print {
+public:
+  FixedString() { clear(); }
+  explicit FixedString(const char *text) { clear(); print(text); }
+
+  void clear() {
+    len = 0;
+    overflow = false;
+    buf[0] = '\0';
+  }
+
+  size_t write(uint8_t b) override {
+    if (len >= N - 1) {
+      overflow = true;
+      return 0;
+    }
+    buf[len++] = (char)b;
+    buf[len] = '\0';
+    return 1;
+  }
+
+  size_t write(const uint8_t *data, size_t size) override {
+    size_t room = N - 1 - len;
+    if (size > room) {
+      size = room;
+      overflow = true;
+    }
+    memcpy(buf + len, data, size);
+    len += size;
+    buf[len] = '\0';
+    return size;
+  }
+  using Print::write;
+
+  // Mutable for APIs that copy a char * but only keep a const char *
+  char *data() { return buf; }
+  const char *c_str() const { return buf; }
+  size_t length() const { return len; }
+  static constexpr size_t capacity() { return N - 1; }
+  bool overflowed() const { return overflow; }
+  bool equals(const char *text) const { return strcmp(buf, text) == 0; }
+
+private:
+  char buf[N];
+  size_t len;
+  bool overflow;
+};
+
+// Dotted quad, "255.255.255.255" plus terminator
+typedef FixedString<16> IPString;
+
+#endif // FIXED_STRING_H
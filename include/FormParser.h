@@ -0,0 +1,74 @@
+// FormParser.h
+#ifndef FORM_PARSER_H
+#define FORM_PARSER_H
+
+#include <Arduino.h>
+#include <IPAddress.h>
+
+//================================
+// FORM PARSER CONFIGURATION
+//================================
+
+#define FORM_MAX_FIELDS  48   // Fields kept per request, the OSC page sends ~25
+
+//================================
+// PARSED FORM
+//================================
+// application/x-www-form-urlencoded data is decoded in place in the receive
+// buffer. Keys and values point straight into it, nothing is copied.
+
+struct FormField {
+  const char *key;
+  const char *value;    // "" for a key without '='
+};
+
+struct FormData {
+  FormField fields[FORM_MAX_FIELDS];
+  uint8_t count;
+  bool truncated;       // More fields than FORM_MAX_FIELDS
+};
+
+// Decode "a=1&b=x%20y" in a single pass. data[length] must be writable,
+// it receives the last terminator. Fields are appended to what is already
+// in the form, so the query string and the body can both be parsed.
+void formClear(FormData &form);
+void formParse(FormData &form, char *data, size_t length);
+
+// Value of the last field named key (so a hidden "0" followed by a checked
+// checkbox reads as "1"), nullptr if absent
+const char *formGet(const FormData &form, const char *key);
+
+// Strict conversions, false on anything but a complete number / address
+bool formParseInt(const char *text, long &value);
+bool formParseIP(const char *text, IPAddress &ip);
+
+//================================
+// TYPED FIELD BINDING
+//================================
+// A table of bindings maps form fields onto config struct members. Bind into
+// a copy of the config and commit it when formBind() succeeds, so a bad field
+// never leaves half a form applied.
+
+enum FormFieldType : uint8_t {
+  FORM_CHECKBOX,   // bool, true when present and not "0" (absent means unchecked)
+  FORM_UINT8,      // uint8_t within [minValue, maxValue]
+  FORM_UINT16,     // uint16_t within [minValue, maxValue]
+  FORM_INT,        // int within [minValue, maxValue]
+  FORM_IP          // IPAddress, dotted quad
+};
+
+struct FormBinding {
+  const char *key;
+  FormFieldType type;
+  void *target;
+  long minValue;
+  long maxValue;
+};
+
+#define FORM_BINDING_COUNT(table) (sizeof(table) / sizeof((table)[0]))
+
+// Missing or empty fields leave the target unchanged (except checkboxes).
+// Returns the key of the first invalid field, nullptr when all are valid.
+const char *formBind(const FormData &form, const FormBinding *bindings, size_t count);
+
+#endif // FORM_PARSER_H
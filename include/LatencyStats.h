@@ -0,0 +1,49 @@
+// LatencyStats.h
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include <Arduino.h>
+
+//================================
+// LATENCY HISTOGRAM
+//================================
+// Power of two buckets in microseconds: bucket 0 is < 32us, bucket n is
+// < 32us << n, the last bucket holds everything slower.
+
+#define LATENCY_BUCKETS 16
+
+struct LatencyHistogram {
+  const char *name;
+  uint32_t buckets[LATENCY_BUCKETS];
+  uint32_t count;
+  uint32_t minUs;
+  uint32_t maxUs;
+  uint64_t totalUs;
+};
+
+// Inbound OSC packet read -> fader motors started
+extern LatencyHistogram oscToMotorLatency;
+
+// Fader touch detected -> first fader value sent to the console
+extern LatencyHistogram touchToOscLatency;
+
+//================================
+// FUNCTION DECLARATIONS
+//================================
+
+void latencyRecord(LatencyHistogram &h, uint32_t us);
+void latencyReset(LatencyHistogram &h);
+void resetLatencyStats();
+
+// Upper edge (us) of a bucket, 0 for the open ended last bucket
+uint32_t latencyBucketLimit(int bucket);
+
+// Upper bucket edge below which this percentage of samples fall
+uint32_t latencyPercentile(const LatencyHistogram &h, int percent);
+
+uint32_t latencyAverage(const LatencyHistogram &h);
+
+// Summary and non-empty buckets of every histogram, for serial or a web client
+void printLatencyStats(Print &out);
+
+#endif // LATENCY_STATS_H
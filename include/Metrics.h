@@ -0,0 +1,72 @@
+// Metrics.h
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+//================================
+// METRICS CONFIGURATION
+//================================
+
+#define METRICS_OLED_INTERVAL_MS 2000   // OLED metrics line refresh, 0 = off (each refresh is a full frame I2C write)
+
+//================================
+// NETWORK COUNTERS
+//================================
+
+struct NetMetrics {
+  uint32_t packetsIn;       // UDP datagrams read
+  uint32_t bytesIn;
+  uint32_t packetsOut;      // UDP datagrams sent (including /pong)
+  uint32_t bytesOut;
+  uint32_t parseErrors;     // Messages LiteOSCParser rejected
+  uint32_t bundleErrors;    // Malformed or too deeply nested bundles
+  uint32_t unknownAddress;  // Valid messages no route matched
+  uint32_t pings;           // /ping probes answered
+  uint32_t telemetryFrames;  // /telemetry frames sent
+  uint32_t telemetryDropped; // Frames skipped because the browser fell behind
+};
+
+extern NetMetrics netMetrics;
+
+//================================
+// HANDLER TIMINGS
+//================================
+// Cycle counter timings, shown in microseconds
+
+enum MetricsHandler {
+  TIMING_OSC_RECEIVE,       // Whole handleOscMessage() pass
+  TIMING_OSC_DISPATCH,      // Parse and route one packet
+  TIMING_FADER_UPDATE,      // handleBundledFaderUpdate()
+  TIMING_FADER_DELTA,       // handleFaderDelta()
+  TIMING_MOTION,            // Driving motors to new setpoints
+  TIMING_OSC_FLUSH,         // Sending the queued output
+  TIMING_LOOP,              // One whole loop() pass
+  TIMING_COUNT
+};
+
+struct HandlerTiming {
+  uint32_t calls;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+};
+
+extern HandlerTiming handlerTimings[TIMING_COUNT];
+
+//================================
+// FUNCTION DECLARATIONS
+//================================
+
+// Record one handler run, cycles measured with ARM_DWT_CYCCNT
+void metricsRecordTiming(MetricsHandler handler, uint32_t cycles);
+
+void resetMetrics();
+
+// Plain text "name value" lines, for /metrics and serial
+void printMetrics(Print &out);
+
+// Refresh the metrics line on the OLED, call from loop()
+void updateMetricsDisplay();
+
+#endif // METRICS_H
@@ -6,6 +6,7 @@
 #include <QNEthernet.h>
 #include <LiteOSCParser.h>
 #include "Config.h"
+#include "OSCWriter.h"
 
 using namespace qindesign::network;
 using qindesign::osc::LiteOSCParser;
@@ -24,19 +25,73 @@ extern EthernetUDP udp;
 void setupNetwork();
 
 // OSC message handling
-void handleOscPacket(const char *address, int value);
 void sendOscUpdate(Fader& f, int value, bool force = false);
-void handleColorOsc(const char *address, const char *colorString);
+void serviceOscRateLimiter();
+
+struct OscLimiterStats {
+  uint32_t sent;        // Fader values sent
+  uint32_t coalesced;   // Pending values replaced by a newer one before sending
+  uint32_t dropped;     // Pending values discarded because the fader returned to the sent value
+};
+const OscLimiterStats &getOscLimiterStats();
+void handleColorOsc(int faderID, const char *colorString);
 
 void restartUDP();
 
-void handleOscMovement(const char *address, int value);
+// OSC over TCP (SLIP framed)
+void startOscTcp();
+void closeOscTcpLinks();
+void serviceOscTcp();
+
+void handleOscMovement(int pageNum, int faderID, int value);
 void handleOscMessage();
+void dispatchOscPacket(const uint8_t *data, int size);
+
+// Address routing and executor ID lookup
+void setupOscRoutes();
+void buildFaderIdLookup();
+int getFaderIndexFromID(int id);
+
+// Bundle decoding and timetag scheduling
+void handleOscBundle(const uint8_t *data, int size, int depth = 0);
+void scheduleOscMessage(uint64_t timetag, const uint8_t *data, int size);
+void serviceOscSchedule();
+
+// Setpoints are queued while draining the socket and applied once per pass
+void queueFaderSetpoint(int faderIndex, int oscValue);
+void applyPendingSetpoints();
 
 void sendOscMessage(const char* address, const char* typeTag, const void* value);
 
+// Zero copy output: encode into the TX buffer with the returned writer, then end.
+// Messages from one loop() tick are sent as a single #bundle by flushOscOutput().
+// endOscMessage() returns false when the bundle was flushed to make room,
+// the message must then be encoded again from beginOscMessage().
+OscWriter &beginOscMessage();
+bool endOscMessage();
+void flushOscOutput(bool force = false);
+
+struct OscOutputStats {
+  uint32_t messages;   // OSC messages produced
+  uint32_t packets;    // Packets encoded (each goes to every destination)
+};
+const OscOutputStats &getOscOutputStats();
+
+// Per destination counters, index 0 is the main console (netConfig.sendToIP),
+// 1..OSC_MAX_DESTINATIONS are oscDestinations[0..]
+struct OscDestinationStats {
+  uint32_t packets;    // UDP datagrams sent
+  uint32_t bytes;
+  uint32_t errors;     // Datagrams the stack refused
+};
+const OscDestinationStats &getOscDestinationStats(int index);
+
+// Page tracking, keeps the fader address templates in step
+void setCurrentOscPage(int page);
+void updateFaderOscAddresses();
+
 // Page update
-void handlePageUpdate(const char *address, int value);
+void handlePageUpdate(int value);
 
 // Color parsing (used by both NetworkOSC and NeoPixelControl)
 void parseColorValues(const char *colorString, Fader& f);
@@ -0,0 +1,53 @@
+// OSCRouter.h
+#ifndef OSC_ROUTER_H
+#define OSC_ROUTER_H
+
+#include <Arduino.h>
+#include <LiteOSCParser.h>
+
+using qindesign::osc::LiteOSCParser;
+
+//================================
+// ROUTER CONFIGURATION
+//================================
+
+#define OSC_ROUTER_MAX_NODES    24   // Trie nodes, one per distinct address segment
+#define OSC_ROUTER_MAX_SEGMENT  24   // Longest segment pattern including terminator
+#define OSC_ROUTER_MAX_CAPTURES 4    // Integer captures per address
+
+// Route patterns are matched one '/' separated segment at a time:
+//   text   must match exactly
+//   #      one or more digits, captured as an integer (e.g. "/Page#/Fader#")
+//   ?      any single character
+//   *      any run of characters inside the segment
+// Literal segments are tried before wildcard segments at each level.
+// Incoming addresses are matched as plain text: OSC pattern characters sent
+// by a client ("/Page1/Fader20[1-5]", "/Page*/Fader201") are not expanded,
+// so such messages match no route and are counted as unknown.
+
+//================================
+// TYPES
+//================================
+
+struct OscRouteMatch {
+  int captures[OSC_ROUTER_MAX_CAPTURES];  // Captured integers in pattern order
+  uint8_t count;                          // Number of valid captures
+};
+
+typedef void (*OscRouteHandler)(LiteOSCParser &parser, const OscRouteMatch &match);
+
+//================================
+// FUNCTION DECLARATIONS
+//================================
+
+// Route table management
+void oscRouterClear();
+bool oscRouterAdd(const char *pattern, OscRouteHandler handler);
+
+// Resolve an address, returns nullptr if no route matches
+OscRouteHandler oscRouterLookup(const char *address, OscRouteMatch &match);
+
+// Resolve the parsed message address and call its handler, false if unrouted
+bool oscRouterDispatch(LiteOSCParser &parser);
+
+#endif // OSC_ROUTER_H
@@ -0,0 +1,83 @@
+// OSCWriter.h
+#ifndef OSC_WRITER_H
+#define OSC_WRITER_H
+
+#include <Arduino.h>
+
+//================================
+// WRITER CONFIGURATION
+//================================
+
+#define OSC_ADDRESS_MAX 32   // Longest padded address template, e.g. "/Page12/Fader201"
+#define OSC_BUNDLE_HEADER_SIZE 16   // "#bundle\0" + 8 byte timetag
+#define OSC_TIMETAG_IMMEDIATE  1ULL // Reserved timetag meaning "apply now"
+
+//================================
+// ADDRESS TEMPLATE
+//================================
+// An OSC address already null terminated and zero padded to a 4 byte
+// boundary, so sending it is a single memcpy. Build once, reuse per send.
+
+struct OscAddress {
+  char data[OSC_ADDRESS_MAX];
+  uint8_t length;   // Padded length in bytes, 0 if unset
+};
+
+// Format an address template (printf style), returns false if it does not fit
+bool oscAddressFormat(OscAddress &address, const char *format, ...);
+
+//================================
+// MESSAGE WRITER
+//================================
+// Encodes OSC messages straight into a caller owned buffer (normally the
+// UDP TX buffer). Typed add functions write each argument in place, there
+// is no intermediate packet. Supports i, f, s and b arguments.
+//
+//   writer.beginMessage(address, ",if");
+//   writer.addInt(1);
+//   writer.addFloat(0.5f);
+//   writer.endMessage();
+//
+// After beginBundle() every message is written as a bundle element, its
+// size field is filled in by endMessage().
+
+class OscWriter {
+public:
+  OscWriter(uint8_t *buffer, size_t capacity);
+
+  void reset();                       // Start a new packet
+  bool beginBundle(uint64_t timetag = OSC_TIMETAG_IMMEDIATE);
+
+  bool beginMessage(const OscAddress &address, const char *typeTags);
+  bool beginMessage(const char *address, const char *typeTags);
+  bool addInt(int32_t value);
+  bool addFloat(float value);
+  bool addString(const char *value);
+  bool addBlob(const uint8_t *data, size_t length);
+  bool endMessage();
+  void rollbackMessage();             // Drop a partly written message
+
+  const uint8_t *data() const { return buf; }
+  size_t size() const { return len; }
+  size_t capacity() const { return cap; }
+  size_t remaining() const { return cap - len; }
+  bool overflowed() const { return overflow; }
+  bool isBundle() const { return inBundle; }
+  int messageCount() const { return messages; }
+
+private:
+  bool reserve(size_t bytes);
+  void writeBE32(uint32_t value);
+  void writePadded(const void *data, size_t length);  // Copy, null terminate, pad
+  bool startElement(size_t headerBytes);              // Mark message start, reserve size field
+
+  uint8_t *buf;
+  size_t cap;
+  size_t len;
+  bool overflow;
+  bool inBundle;
+  size_t messageStart;   // Offset where the current message (or its size field) begins
+  int messages;          // Completed messages in the packet
+};
+
+#endif // OSC_WRITER_H
@@ -0,0 +1,29 @@
+// PageCache.h
+#ifndef PAGE_CACHE_H
+#define PAGE_CACHE_H
+
+#include <Arduino.h>
+#include "Config.h"
+
+//================================
+// PAGE CACHE CONFIGURATION
+//================================
+
+#define PAGE_CACHE_SLOTS 8   // Recently visited pages kept in RAM (least recently used is replaced)
+
+//================================
+// FUNCTION DECLARATIONS
+//================================
+
+// Snapshot the fader setpoints and colors of a page (called when leaving it)
+void pageCacheStore(int page);
+
+// Queue cached setpoints and apply cached colors, false if the page is not cached
+bool pageCacheRecall(int page);
+
+// Mark the current page as confirmed by the console, only confirmed pages are cached
+void pageCacheMarkSynced();
+
+void pageCacheClear();
+
+#endif // PAGE_CACHE_H
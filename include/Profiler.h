@@ -0,0 +1,103 @@
+// Profiler.h
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+
+//================================
+// PROFILER CONFIGURATION
+//================================
+
+// Release builds pass -DPROFILER_ENABLED=0 (env:teensy41_release), every
+// zone then compiles to nothing
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+#define PROFILER_MAX_ZONES    32
+#define PROFILER_MIN_SHIFT    4      // Bucket 0 holds everything under 16 ticks
+#define PROFILER_BUCKETS      97     // 4 per power of two up to 2^28 ticks, last is open ended
+
+//================================
+// SCOPED PROFILE ZONES
+//================================
+// Time a block from where the macro stands to the end of the scope:
+//
+//   void pollSlave(...) {
+//     PROFILE_ZONE("i2c_slave");
+//     ...
+//   }
+//
+// Each zone keeps count, min/avg/max and a histogram in fixed memory, good
+// for p99 within a quarter of a power of two. Ticks are ARM_DWT_CYCCNT
+// cycles on the Teensy and std::chrono nanoseconds on a host build.
+// Zones register themselves the first time they run.
+
+struct ProfileZone {
+#if PROFILER_ENABLED
+  const char *name;               // Set when registered
+  uint32_t count;
+  uint32_t minTicks;
+  uint32_t maxTicks;
+  uint64_t totalTicks;
+  uint32_t buckets[PROFILER_BUCKETS];
+#endif
+};
+
+#if PROFILER_ENABLED
+
+#if defined(ARDUINO)
+static inline uint32_t profilerTicks() { return ARM_DWT_CYCCNT; }
+#else
+uint32_t profilerTicks();
+#endif
+uint32_t profilerTicksPerUs();
+
+void profilerRegister(ProfileZone &zone, const char *name);
+void profilerRecord(ProfileZone &zone, uint32_t ticks);
+
+class ProfileScope {
+public:
+  ProfileScope(ProfileZone &zone, const char *name) : zone(zone) {
+    if (zone.name == nullptr) profilerRegister(zone, name);
+    start = profilerTicks();
+  }
+  ~ProfileScope() { profilerRecord(zone, profilerTicks() - start); }
+
+private:
+  ProfileZone &zone;
+  uint32_t start;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_ZONE(name) \
+  static ProfileZone PROFILE_CONCAT(profileZone_, __LINE__); \
+  ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(PROFILE_CONCAT(profileZone_, __LINE__), name)
+
+#else
+
+class ProfileScope {
+public:
+  ProfileScope(ProfileZone &, const char *) {}
+};
+
+#define PROFILE_ZONE(name) do { } while (0)
+
+#endif // PROFILER_ENABLED
+
+//================================
+// REPORTING
+//================================
+// Available in every build, they report "profiler disabled" in release
+
+void resetProfiler();
+
+// One "[PROFILE] name n= min= avg= p99< max= ns" line per zone, serial and /profile
+void printProfile(Print &out);
+
+// Short "zone p99" text for the OLED, a different zone on each call.
+// Returns false when there is nothing to show.
+bool formatProfileLine(char *buffer, size_t capacity);
+
+#endif // PROFILER_H
@@ -0,0 +1,36 @@
+// ResponseBuffer.h
+#ifndef RESPONSE_BUFFER_H
+#define RESPONSE_BUFFER_H
+
+#include <Arduino.h>
+
+//================================
+// RESPONSE BUFFER
+//================================
+// A Print that collects a whole HTTP response in a fixed buffer. Page
+// handlers print into it exactly as they used to print to the socket, the
+// web server then streams the buffer out as the connection has room.
+// Output past the end is dropped and flagged.
+
+class ResponseBuffer : public Print {
+public:
+  ResponseBuffer();
+
+  void attach(uint8_t *buffer, size_t capacity);   // Start a new response
+
+  size_t write(uint8_t b) override;
+  size_t write(const uint8_t *data, size_t size) override;
+  using Print::write;
+
+  const uint8_t *data() const { return buf; }
+  size_t size() const { return len; }
+  bool overflowed() const { return overflow; }
+
+private:
+  uint8_t *buf;
+  size_t cap;
+  size_t len;
+  bool overflow;
+};
+
+#endif // RESPONSE_BUFFER_H
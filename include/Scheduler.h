@@ -0,0 +1,74 @@
+// Scheduler.h
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include "Profiler.h"
+
+//================================
+// SCHEDULER CONFIGURATION
+//================================
+
+#define SCHEDULER_MAX_TASKS  16
+
+//================================
+// COOPERATIVE TASK SCHEDULER
+//================================
+// loop() calls runScheduler(), which picks what to run from the task table:
+//
+//   1. Every due TASK_CRITICAL task, in the order they were added
+//   2. Then at most ONE other due task, highest priority first, the most
+//      overdue one among equal priorities
+//
+// A task waiting past its due time gains one priority level for every full
+// period it is late (up to TASK_HIGH), so a NORMAL task that is due on
+// nearly every pass cannot starve the LOW ones.
+//
+// So a critical task (motion, touch, keys) never waits longer than one
+// pass of the critical tasks plus the single longest other task. Tasks
+// still run to completion, so none of them may block: the budget is what
+// a task is expected to need and every run past it is counted as an
+// overrun.
+//
+// A period of 0 means every pass and no aging. Give non-critical tasks a
+// real period, otherwise they can keep lower priority tasks from ever
+// running.
+
+enum TaskPriority : uint8_t {
+  TASK_CRITICAL,    // Runs whenever due, before anything else
+  TASK_HIGH,
+  TASK_NORMAL,
+  TASK_LOW
+};
+
+typedef void (*TaskFunction)();
+
+struct Task {
+  const char *name;
+  TaskFunction run;
+  uint32_t periodUs;
+  uint32_t budgetUs;
+  TaskPriority priority;
+
+  uint32_t lastStart;       // micros() of the last run
+  uint32_t runs;
+  uint32_t overruns;        // Runs longer than budgetUs
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  uint32_t maxLateUs;       // Longest wait past the due time
+  ProfileZone zone;         // Each task is a profile zone under its own name
+};
+
+// Returns false when the table is full
+bool addTask(const char *name, TaskFunction run, uint32_t periodUs,
+             TaskPriority priority, uint32_t budgetUs);
+
+// One scheduling pass, call from loop()
+void runScheduler();
+
+void resetTaskStats();
+
+// "task_<name>_..." lines, part of printMetrics()
+void printTaskStats(Print &out);
+
+#endif // SCHEDULER_H
@@ -0,0 +1,56 @@
+// SlipCodec.h
+#ifndef SLIP_CODEC_H
+#define SLIP_CODEC_H
+
+#include <Arduino.h>
+
+//================================
+// SLIP FRAMING
+//================================
+// OSC 1.1 stream framing (RFC 1055, double END): every packet is sent as
+// END, data with END/ESC escaped, END. Empty frames between two ENDs are
+// ignored by the decoder.
+
+#define SLIP_END     0xC0
+#define SLIP_ESC     0xDB
+#define SLIP_ESC_END 0xDC
+#define SLIP_ESC_ESC 0xDD
+
+// Worst case encoded size of a packet (every byte escaped, plus both ENDs)
+#define SLIP_ENCODED_MAX(size) (2 * (size) + 2)
+
+// Encode a packet into out, returns the encoded size or 0 if it does not fit
+size_t slipEncode(const uint8_t *data, size_t size, uint8_t *out, size_t capacity);
+
+//================================
+// STREAMING DECODER
+//================================
+// Fed one byte at a time from a TCP stream, decodes into a caller owned
+// buffer. Frames larger than the buffer are dropped up to the next END.
+//
+//   if (decoder.feed(byte)) dispatch(decoder.data(), decoder.size());
+//
+// A completed frame stays valid until the next feed().
+
+class SlipDecoder {
+public:
+  SlipDecoder(uint8_t *buffer, size_t capacity);
+
+  bool feed(uint8_t byte);   // True when a complete frame is ready
+  void reset();
+
+  const uint8_t *data() const { return buf; }
+  size_t size() const { return len; }
+  uint32_t droppedFrames() const { return dropped; }
+
+private:
+  uint8_t *buf;
+  size_t cap;
+  size_t len;
+  bool escaped;
+  bool overflow;
+  bool ready;
+  uint32_t dropped;
+};
+
+#endif // SLIP_CODEC_H
@@ -0,0 +1,31 @@
+// Telemetry.h
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+//================================
+// TELEMETRY CONFIGURATION
+//================================
+
+#define TELEMETRY_DEFAULT_HZ   20     // Frame rate when /telemetry is opened without ?hz=
+#define TELEMETRY_MAX_HZ       100
+#define TELEMETRY_MAX_STREAMS  1      // Streams hold a web connection each
+#define TELEMETRY_FRAME_MAX    512    // Largest frame, also the socket room needed to send one
+
+//================================
+// FUNCTION DECLARATIONS
+//================================
+
+// Call once per loop() pass with its length from ARM_DWT_CYCCNT
+void telemetryRecordLoop(uint32_t cycles);
+
+// One Server-Sent Events frame with every fader's position, setpoint, PWM
+// and touch state plus loop timing since the previous frame:
+//   data: {"t":ms,"loop":[avgUs,maxUs,passes],"f":[[position,setpoint,pwm,touched,raw],...]}
+// Position and setpoint are 0-100 like OSC, raw is the ADC reading. Only one
+// fader is read fresh per frame, the others report their last reading.
+// Returns its length, 0 if it did not fit.
+size_t buildTelemetryFrame(char *buffer, size_t capacity);
+
+#endif // TELEMETRY_H
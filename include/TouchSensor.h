@@ -6,6 +6,7 @@
 #include <Wire.h>
 #include <Adafruit_MPR121.h>
 #include "Config.h"
+#include "FixedString.h"
 
 //================================
 // TOUCH SENSOR CONFIGURATION
@@ -40,7 +41,8 @@ extern const unsigned long REINIT_DELAY_BASE;
 extern Adafruit_MPR121 mpr121;
 extern volatile bool touchStateChanged;
 extern bool touchErrorOccurred;
-extern String lastTouchError;
+extern FixedString<64> lastTouchError;
+extern bool touchSetupPending;
 extern int reinitializationAttempts;
 extern unsigned long lastReinitTime;
 
@@ -55,6 +57,7 @@ extern bool touchConfirmed[NUM_FADERS];
 // Main setup and processing functions
 bool setupTouch();
 bool processTouchChanges();
+void requestTouchSetup();   // setupTouch() on the next processTouchChanges()
 
 // Interrupt handler
 void handleTouchInterrupt();
@@ -70,7 +73,7 @@ void recalibrateBaselines();
 
 // Error handling functions
 void handleTouchError();
-String getLastTouchError();
+const char *getLastTouchError();
 bool hasTouchError();
 void clearTouchError();
 
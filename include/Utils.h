@@ -4,6 +4,7 @@
 
 #include <Arduino.h>
 #include <IPAddress.h>
+#include "FixedString.h"
 
 //================================
 // DEBUG FUNCTIONS
@@ -24,15 +25,7 @@ void checkSerialForReboot();   //Allow us to upload without pressing physical bu
 // IP ADDRESS UTILITIES
 //================================
 
-// IP address conversion helpers
-String ipToString(IPAddress ip);
-IPAddress stringToIP(const String &str);
-
-//================================
-// WEB PARAMETER PARSING
-//================================
-
-// Extract parameter from URL query string
-String getParam(String data, const char* key);
+// Dotted quad text, parse with formParseIP() (FormParser.h)
+IPString ipToString(IPAddress ip);
 
 #endif // UTILS_H
\ No newline at end of file
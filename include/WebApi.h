@@ -0,0 +1,35 @@
+// WebApi.h
+#ifndef WEB_API_H
+#define WEB_API_H
+
+#include <Arduino.h>
+
+//================================
+// API CONFIGURATION
+//================================
+
+#define API_JSON_CAPACITY  4096   // Static document for requests and responses
+
+//================================
+// JSON REST API
+//================================
+// Served under /api/v1 for provisioning scripts:
+//
+//   GET/PUT /api/v1/config               All sections below in one document
+//   GET/PUT /api/v1/config/fader         FaderConfig
+//   GET/PUT /api/v1/config/network       NetworkConfig and the extra OSC destinations
+//   GET/PUT /api/v1/config/touch         TouchConfig
+//   GET/PUT /api/v1/calibration          Calibrated min/max per fader (PUT 409 while the job runs)
+//   GET     /api/v1/faders               Position, setpoint, touched and color per fader
+//   GET     /api/v1/calibration/job      Progress and per-fader result of the calibration job
+//   POST    /api/v1/calibration/job      Start it (409 if already running)
+//   DELETE  /api/v1/calibration/job      Cancel it, the previous calibration stays
+//
+// PUT takes partial documents, fields left out keep their value. Every field
+// of every section is validated before anything is applied, a bad request
+// changes nothing. Accepted sections are then saved to EEPROM once each.
+
+// path is what follows /api/v1, body is the raw request body (parsed in place)
+void handleApiRequest(const char *method, const char *path, char *body, size_t bodyLength);
+
+#endif // WEB_API_H
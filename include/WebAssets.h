@@ -0,0 +1,26 @@
+// WebAssets.h
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+//================================
+// STATIC WEB ASSETS
+//================================
+// The pages, CSS and JS in web/ are gzipped into flash at build time by
+// tools/build_web_assets.py (generates src/WebAssets.cpp). Live values are
+// filled in by app.js from /state.json.
+
+struct WebAsset {
+  const char *path;           // URL path, e.g. "/style.css"
+  const char *contentType;
+  const char *cacheControl;
+  const char *etag;           // Quoted, changes whenever the content does
+  const uint8_t *data;        // Gzipped, in flash
+  uint32_t size;
+};
+
+extern const WebAsset webAssets[];
+extern const size_t webAssetCount;
+
+#endif // WEB_ASSETS_H
@@ -5,16 +5,30 @@
 #include <Arduino.h>
 #include <QNEthernet.h>
 #include "Config.h"
+#include "ResponseBuffer.h"
+#include "FormParser.h"
+#include "Arena.h"
 
 using namespace qindesign::network;
 
+//================================
+// WEB SERVER CONFIGURATION
+//================================
+
+#define WEB_MAX_CLIENTS        3      // Connections served at once
+#define WEB_REQUEST_MAX        2048   // Request line, headers and body
+#define WEB_RESPONSE_MAX       16384  // Largest page, per connection (in DMAMEM), bigger ones get a 500
+#define WEB_POLL_BUDGET_US     300    // Socket work per pollWebServer() call
+#define WEB_CLIENT_TIMEOUT_MS  3000   // Drop connections idle this long
+#define WEB_ARENA_SIZE         4096   // Scratch memory per request, reset before each one
+
 //================================
 // GLOBAL WEB SERVER OBJECTS
 //================================
 
 extern EthernetUDP udp;  // Also declare udp for consistency
 extern EthernetServer server;
-extern EthernetClient client;
+extern ResponseBuffer client;   // Response being built, handlers print into it
 
 
 //================================
@@ -22,41 +36,39 @@ extern EthernetClient client;
 //================================
 
 // New OSC settings handler
-void handleOSCSettings(String request);
+void handleOSCSettings(const FormData &form);
 
 // Validation functions
 bool isValidIP(IPAddress ip);
 bool isValidPort(int port);
-void sendErrorResponse(const char* errorMsg);
+void sendErrorResponse(const char* errorMsg, const char *status = "400 Bad Request");
 
 // Server management
 void startWebServer();
 void pollWebServer();
-void handleWebServer();
+
+// Scratch memory of the request being handled, gone once it returns
+Arena &webRequestArena();
 
 // Request handlers
-void handleNetworkSettings(String request);
-void handleCalibrationSettings(String request);
-void handleFaderSettings(String request);
-void handleTouchSettings(String request);
+// Settings handlers take the decoded query string and form body
+void handleNetworkSettings(const FormData &form);
+void handleCalibrationSettings(const FormData &form);
+void handleFaderSettings(const FormData &form);
+void handleTouchSettings(const FormData &form);
 void handleRunCalibration();
-void handleDebugToggle(String requestBody);
+void handleDebugToggle(const FormData &form);
 void handleResetDefaults();
 void handleNetworkReset();
 
-// Html building functions
-void handleRoot();
-void handleStatsPage();
-void handleFaderSettingsPage();
-void handleOSCSettingsPage();
-
-void sendCommonStyles();
-void sendNavigationHeader(const char* pageTitle);
-
-void waitForWriteSpace();
+// Pages are static assets (web/, see WebAssets.h), these feed them
+void handleStateJson();
+void handleTelemetryStream(const FormData &form);
+void handleMetrics();
 
 // Response helpers
 void send404Response();
+void sendMethodNotAllowed();
 void sendRedirect();
 
 #endif // WEB_SERVER_H
\ No newline at end of file
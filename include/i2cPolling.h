@@ -13,6 +13,16 @@ void processKeypressData(uint8_t count, uint8_t address);
 void sendEncoderOSC(int encoderNumber, bool isPositive, int velocity);
 void sendKeyOSC(uint16_t keyNumber, uint8_t state);
 
+// Encoder coalescing: events are summed per encoder and sent once per window
+void accumulateEncoder(int encoderNumber, int signedVelocity);
+void flushEncoderOSC(bool force = false);
+
+struct EncoderStats {
+  uint32_t events;     // Encoder events received from the slaves
+  uint32_t messages;   // /Encoder messages sent after coalescing
+};
+const EncoderStats &getEncoderStats();
+
 #endif  // I2C_POLLING_H
 
 
@@ -1,14 +1,35 @@
 -- EVOFaderWing Lua script for syncing EVOFaderWing using OSC
--- Sends ALL data as ONE OSC message: page + fader values (0-100) + color values
--- OSC sent when data has changed or after autoResendInterval
+-- Sends /faderDelta: page + changed-fader mask + value (0-100) and packed RGB of each changed fader
+-- All faders are sent on page change, on a forced reload, or when the wing reports a different state
 --
--- Set autoResendInterval via: SetVar(GlobalVars(), "autoResendInterval", 600) 
--- (600 = 30 seconds, since main loop runs every 0.05 seconds)
--- Default is 300 (15 seconds)
+-- Changes are pushed as soon as an object change hook fires for a watched executor.
+-- Executors are also polled every pollInterval to catch changes that do not fire a hook.
+-- The executor index is rebuilt when the page's executors are added, deleted or get a
+-- different object, so no stale handle is read.
+--
+-- Every autoResendInterval the script sends /faderSync with a hash of what it has sent.
+-- The wing answers by setting the global variable EvoWingAck to "page:hash" over OSC /cmd.
+-- A full resend only happens when that answer is missing or does not match.
+-- The console's OSC input from the wing needs "Receive Command" enabled for the answer.
+--
+-- For wing firmware without /faderDelta: SetVar(GlobalVars(), "compactUpdate", false)
+-- sends the full /faderUpdate message (page + 10 values + 10 color strings) and resends
+-- everything every autoResendInterval instead
+--
+-- Set autoResendInterval via: SetVar(GlobalVars(), "autoResendInterval", 100) 
+-- (in 20ths of a second, 100 = 5 seconds)
+-- Default is 40 (2 seconds)
+--
+-- Set pollInterval via: SetVar(GlobalVars(), "pollInterval", 10) 
+-- (in 20ths of a second, 10 = 0.5 seconds) Default is 2 (0.1 seconds)
+--
+-- Set the hook check rate via: SetVar(GlobalVars(), "tickRate", 50) 
+-- (checks per second, read at start) Default is 100 (every 0.01 seconds)
 --
 -- Special thanks to xxpasixx for his pam-osc code which I modified for my project
 -- GPL3
 
+local pluginHandle = select(4, ...)
 
 local function StartGui()
     -- Check current status
@@ -41,183 +62,305 @@ function main()
         SetVar(GlobalVars(), "opdateOSC", true)
         
         
-        local executorsToWatch = {}
+        -- Wing fader i (1-10) shows executor 200+i, with 100+i as its secondary color
         local oldValues = {}
-        local oldColorValues = {}
+        local oldColors = {}
+        local values = {}
+        local colors = {}
+
+        -- Executors of the current page by number, rebuilt when the page or its executors
+        -- change instead of scanning every child on every tick
+        local execByNo = {}
+        -- HandleToInt of each indexed executor's object, to notice a slot reassigned
+        local objectIds = {}
+        local indexStale = false
 
         local oscEntry = 2
 
-        -- Configure executors to watch: faders 201-210 AND 101-110 for color support when using 101-110 as well
-        for i = 201, 210 do
-            executorsToWatch[#executorsToWatch + 1] = i
+        for i = 1, 10 do
+            oldValues[i] = -1
+            oldColors[i] = -1
+            values[i] = 0
+            colors[i] = 0
         end
-        for i = 101, 110 do
-            executorsToWatch[#executorsToWatch + 1] = i
+
+        -- Bits for all ten faders in the /faderDelta mask
+        local FULL_MASK = 0x3FF
+
+        -- Message parts reused every send: "/faderDelta,ii" + "ii" per fader, page, mask, value/color pairs
+        local typeTags = { "/faderDelta,ii" }
+        local args = {}
+
+        -- Object change hooks on the indexed executors and their sequences
+        local hookIds = {}
+        local dirty = true
+
+        -- Reused for every GetFader call
+        local faderOptions = {}
+        faderOptions.value = faderEnd
+        faderOptions.token = "FaderMaster"
+        faderOptions.faderDisabled = false
+
+        -- How often to look for hooked changes, in checks per second (default 100 = 10ms).
+        -- A check without a hook or poll due only reads a few variables.
+        local tickRate = GetVar(GlobalVars(), "tickRate") or 100
+        local tick = 1 / tickRate
+        local pollTime = 0
+        local syncTime = 0
+        local expectedAck = nil
+
+        local function onExecutorChange(obj)
+            dirty = true
         end
 
-        -- Set the default values for faders 201-210
-        for i = 201, 210 do
-            oldValues[i] = "000"
+        -- Executor added to or removed from the watched page
+        local function onPageChange(obj)
+            indexStale = true
+            dirty = true
         end
 
-        -- Set the default color values for both ranges (201-210 primary, 101-110 secondary)
-        for i = 201, 210 do
-            oldColorValues[i] = "0,0,0,0"
+        local function unhookExecutors()
+            for i = #hookIds, 1, -1 do
+                Unhook(hookIds[i])
+                hookIds[i] = nil
+            end
         end
-        for i = 101, 110 do
-            oldColorValues[i] = "0,0,0,0"
+
+        local function buildExecutorIndex(page)
+            unhookExecutors()
+            for k in pairs(execByNo) do
+                execByNo[k] = nil
+                objectIds[k] = nil
+            end
+            local pageObj = DataPool().Pages[page]
+            hookIds[#hookIds + 1] = HookObjectChange(onPageChange, pageObj, pluginHandle)
+            for _, exec in pairs(pageObj:Children()) do
+                local no = exec.No
+                if (no >= 201 and no <= 210) or (no >= 101 and no <= 110) then
+                    execByNo[no] = exec
+                    hookIds[#hookIds + 1] = HookObjectChange(onExecutorChange, exec, pluginHandle)
+                    if exec.Object ~= nil then
+                        objectIds[no] = HandleToInt(exec.Object)
+                        hookIds[#hookIds + 1] = HookObjectChange(onExecutorChange, exec.Object, pluginHandle)
+                    end
+                end
+            end
+            indexStale = false
         end
 
-        -- The speed to check executors
-        local tick = 1 / 20 -- 1/20 second = 50ms
-        local resendTick = 0
+        -- True when an indexed executor was deleted or now holds a different object
+        local function indexChanged()
+            for no, exec in pairs(execByNo) do
+                if not IsObjectValid(exec) then
+                    return true
+                end
+                local object = exec.Object
+                local id = nil
+                if object ~= nil then
+                    id = HandleToInt(object)
+                end
+                if id ~= objectIds[no] then
+                    return true
+                end
+            end
+            return false
+        end
 
-        local function getAppearanceColor(sequence)
-            local apper = sequence["APPEARANCE"]
-            if apper ~= nil then
-                return apper['BACKR'] .. "," .. apper['BACKG'] .. "," .. apper['BACKB'] .. "," .. apper['BACKALPHA']
-            else
-                return "255,255,255,255"
+        -- FNV-1a over page, then value and color of each fader, 4 bytes each little endian.
+        -- Must match getFaderStateHash() in the wing firmware.
+        local function stateHash(page)
+            local hash = 2166136261
+            local function addWord(word)
+                word = word & 0xFFFFFFFF
+                for b = 0, 3 do
+                    hash = ((hash ~ ((word >> (b * 8)) & 0xFF)) * 16777619) & 0xFFFFFFFF
+                end
             end
+            addWord(page)
+            for i = 1, 10 do
+                addWord(oldValues[i])
+                addWord(oldColors[i])
+            end
+            return hash
         end
 
-        -- Get automatic resend interval (in 20ths of seconds) - default to 300 (15 seconds)
-        local autoResendInterval = GetVar(GlobalVars(), "autoResendInterval") or 300
+        -- Appearance color as 0xRRGGBB, nil if the executor has no object
+        local function getAppearanceColor(exec)
+            if exec == nil then
+                return nil
+            end
+            local object = exec.Object
+            if object == nil then
+                return nil
+            end
+            local apper = object["APPEARANCE"]
+            if apper == nil then
+                return 0xFFFFFF
+            end
+            return (math.floor(apper['BACKR']) << 16) | (math.floor(apper['BACKG']) << 8) | math.floor(apper['BACKB'])
+        end
+
+        -- Same color as a "R;G;B;A" string for the old /faderUpdate format
+        local function colorString(exec)
+            if exec == nil or exec.Object == nil then
+                return "0;0;0;0"
+            end
+            local apper = exec.Object["APPEARANCE"]
+            if apper == nil then
+                return "255;255;255;255"
+            end
+            return apper['BACKR'] .. ";" .. apper['BACKG'] .. ";" .. apper['BACKB'] .. ";" .. apper['BACKALPHA']
+        end
+
+        -- Get sync check interval (in 20ths of seconds) - default to 40 (2 seconds)
+        local autoResendInterval = GetVar(GlobalVars(), "autoResendInterval") or 40
 
         Printf("start EvoFaderWing OSC - watching faders 201-210 (values) + 201-210,101-110 Colors")
         Printf("autoResendInterval: " .. autoResendInterval .. " (every " .. (autoResendInterval / 20) .. " seconds)")
+        Printf("tickRate: " .. tickRate .. " checks per second")
 
         local destPage = 1
         local forceReload = true
 
         while (GetVar(GlobalVars(), "opdateOSC")) do
-            -- Get current auto resend interval (can be changed at runtime)
-            local autoResendInterval = GetVar(GlobalVars(), "autoResendInterval") or 300
+            -- Get current intervals (can be changed at runtime)
+            local autoResendInterval = GetVar(GlobalVars(), "autoResendInterval") or 40
+            local pollInterval = GetVar(GlobalVars(), "pollInterval") or 2
+
+            -- Compact /faderDelta unless disabled for older wing firmware
+            local compactUpdate = GetVar(GlobalVars(), "compactUpdate") ~= false
             
             if GetVar(GlobalVars(), "forceReload") == true then
                 forceReload = true
                 SetVar(GlobalVars(), "forceReload", false)
             end
 
-            -- Increment resend counter and check for automatic resend 
-            resendTick = resendTick + 1
-            if resendTick >= autoResendInterval then
-                forceReload = true
-                resendTick = 0
-                Printf("Auto force reload triggered (every " .. (autoResendInterval / 20) .. " seconds)")
+            -- Slow poll for changes that do not fire a hook
+            pollTime = pollTime + tick
+            if pollTime >= pollInterval / 20 then
+                dirty = true
+                pollTime = 0
             end
 
-            local dataChanged = false
+            -- Sync check: full resend only if the wing's last answer did not match
+            local sendSync = false
+            syncTime = syncTime + tick
+            if syncTime >= autoResendInterval / 20 then
+                syncTime = 0
+                if not compactUpdate then
+                    forceReload = true
+                elseif expectedAck ~= nil and tostring(GetVar(GlobalVars(), "EvoWingAck")) ~= expectedAck then
+                    forceReload = true
+                    Printf("EvoFaderWing state mismatch, resending all faders")
+                end
+                sendSync = compactUpdate
+            end
 
             -- Check Page
             local myPage = CurrentExecPage()
             if myPage.index ~= destPage then
                 destPage = myPage.index
-                -- Reset fader values (201-210)
-                for i = 201, 210 do
-                    oldValues[i] = 000
-                end
-                -- Reset color values for both ranges (201-210 primary, 101-110 secondary)
-                for i = 201, 210 do
-                    oldColorValues[i] = "0,0,0,0"
-                end
-                for i = 101, 110 do
-                    oldColorValues[i] = "0,0,0,0"
-                end
                 forceReload = true
-                dataChanged = true
-            end
-
-            -- Get all Executors
-            local executors = DataPool().Pages[destPage]:Children()
-
-            -- Collect all current values
-            local currentFaderValues = {}
-            local currentColorValues = {}
-
-            -- Collect data from all watched executors (201-210 and 101-110)
-            for listKey, listValue in pairs(executorsToWatch) do
-                local faderValue = 0
-                local colorValue = "0,0,0,0"
-
-                -- Set Fader & Color Values
-                for maKey, maValue in pairs(executors) do
-                    if maValue.No == listValue then
-                        -- Only get fader values from 201-210 range
-                        if listValue >= 201 and listValue <= 210 then
-                            local faderOptions = {}
-                            faderOptions.value = faderEnd
-                            faderOptions.token = "FaderMaster"
-                            faderOptions.faderDisabled = false
-
-                            faderValue = maValue:GetFader(faderOptions)
-                            currentFaderValues[listValue] = faderValue
-                        end
-
-                        -- Get color values from both ranges (201-210 and 101-110)
-                        local myobject = maValue.Object
-                        if myobject ~= nil then
-                            colorValue = getAppearanceColor(myobject)
-                        end
-                        currentColorValues[listValue] = colorValue
-                    end
+            end
+
+            -- Rebuild before any GetFader so a deleted or reassigned executor is never read.
+            -- Checked on hooks and polls only, a quiet tick does not walk the index.
+            if forceReload or indexStale or (dirty and indexChanged()) then
+                buildExecutorIndex(destPage)
+            end
+
+            if not (dirty or forceReload or sendSync) then
+                coroutine.yield(tick)
+                goto continue
+            end
+
+            -- Work out which wing faders changed since the last send
+            local changedMask = 0
+            for i = 1, 10 do
+                local exec = execByNo[200 + i]
+                local value = 0
+                if exec ~= nil then
+                    value = math.floor(exec:GetFader(faderOptions))
                 end
 
-                -- Check if fader values changed (201-210 only)
-                if listValue >= 201 and listValue <= 210 then
-                    if oldValues[listValue] ~= faderValue then
-                        dataChanged = true
-                    end
+                -- Primary color, or secondary when primary is black or missing
+                local color = getAppearanceColor(exec)
+                if color == nil or color == 0 then
+                    color = getAppearanceColor(execByNo[100 + i]) or 0
                 end
 
-                -- Check if color values changed (both ranges)
-                if oldColorValues[listValue] ~= colorValue then
-                    dataChanged = true
+                values[i] = value
+                colors[i] = color
+                if value ~= oldValues[i] or color ~= oldColors[i] then
+                    changedMask = changedMask | (1 << (i - 1))
                 end
             end
 
-            -- Send single OSC message with ALL data if anything changed
-            if dataChanged or forceReload then
+            if forceReload then
+                changedMask = FULL_MASK
+            end
+
+            if changedMask ~= 0 and compactUpdate then
+                -- /faderDelta: page, mask, then value + packed RGB for each changed fader
+                local tagCount = 1
+                local argCount = 2
+                args[1] = destPage
+                args[2] = changedMask
+                for i = 1, 10 do
+                    if changedMask & (1 << (i - 1)) ~= 0 then
+                        tagCount = tagCount + 1
+                        typeTags[tagCount] = "ii"
+                        args[argCount + 1] = values[i]
+                        args[argCount + 2] = colors[i]
+                        argCount = argCount + 2
+                    end
+                end
+
+                Cmd('SendOSC ' .. oscEntry .. ' "' .. table.concat(typeTags, "", 1, tagCount) .. "," .. table.concat(args, ",", 1, argCount) .. '"')
+            elseif changedMask ~= 0 then
                 -- Build OSC message: page + 10 fader values (0-100) + 10 dual color strings
-                local oscMessage = "/faderUpdate,iiiiiiiiiiissssssssss," .. destPage
-                
-                -- Add all fader values (201-210) as 0-100 integers (no conversion needed)
-                for i = 201, 210 do
-                    local faderValue = currentFaderValues[i] or 0
-                    oscMessage = oscMessage .. "," .. math.floor(faderValue)
-                    oldValues[i] = faderValue
+                args[1] = "/faderUpdate,iiiiiiiiiiissssssssss"
+                args[2] = destPage
+                for i = 1, 10 do
+                    args[i + 2] = values[i]
                 end
                 
-                -- Add all dual color values (primary from 201-210, secondary from 101-110)
+                -- Dual color values: primary from 201-210, secondary from 101-110
                 for i = 1, 10 do
-                    local primaryFader = 200 + i  -- 201-210
-                    local secondaryFader = 100 + i  -- 101-110
-                    
-                    local primaryColor = currentColorValues[primaryFader] or "0,0,0,0"
-                    local secondaryColor = currentColorValues[secondaryFader] or "0,0,0,0"
-                    
-                    -- Convert comma separators to semicolons and combine primary + secondary
-                    local primaryColorSemicolon = string.gsub(primaryColor, ",", ";")
-                    local secondaryColorSemicolon = string.gsub(secondaryColor, ",", ";")
-                    local combinedColor = primaryColorSemicolon .. ";" .. secondaryColorSemicolon
-                    
-                    oscMessage = oscMessage .. "," .. combinedColor
-                    
-                    -- Update old values for both ranges
-                    oldColorValues[primaryFader] = primaryColor
-                    oldColorValues[secondaryFader] = secondaryColor
+                    args[i + 12] = colorString(execByNo[200 + i]) .. ";" .. colorString(execByNo[100 + i])
                 end
 
                 -- Send the single packet containing everything
-                Cmd('SendOSC ' .. oscEntry .. ' "' .. oscMessage .. '"')
+                Cmd('SendOSC ' .. oscEntry .. ' "' .. table.concat(args, ",", 1, 22) .. '"')
                 Printf("Sent fader update: Page " .. destPage .. ".")
             end
+
+            for i = 1, 10 do
+                oldValues[i] = values[i]
+                oldColors[i] = colors[i]
+            end
+
+            -- Ask the wing for its state hash, checked at the next sync interval
+            if sendSync then
+                local hash = stateHash(destPage)
+                expectedAck = destPage .. ":" .. hash
+                -- OSC ints are signed 32 bit, the wing reads the same bits back as unsigned
+                local signedHash = hash
+                if signedHash >= 0x80000000 then
+                    signedHash = signedHash - 0x100000000
+                end
+                Cmd('SendOSC ' .. oscEntry .. ' "/faderSync,ii,' .. destPage .. ',' .. signedHash .. '"')
+            end
             
             forceReload = false
+            dirty = false
 
             -- Main loop delay
             coroutine.yield(tick)
+            ::continue::
         end
+
+        unhookExecutors()
         
     elseif name == "Stop" then
         Printf("Stopping EvoFaderWing OSC...")
@@ -0,0 +1,103 @@
+// Arena.cpp
+
+#include "Arena.h"
+#include <malloc.h>
+
+//================================
+// STORAGE
+//================================
+
+static Arena *registeredArenas[ARENA_MAX_REGISTERED];
+static int registeredArenaCount = 0;
+
+// Heap as it stood when setup() finished
+static size_t heapBootInUse = 0;
+static size_t heapBootTop = 0;
+
+//================================
+// ALLOCATION
+//================================
+
+void arenaInit(Arena &arena, const char *name, void *buffer, size_t capacity) {
+  arena.name = name;
+  arena.base = (uint8_t *)buffer;
+  arena.capacity = capacity;
+  arena.used = 0;
+  arena.highWater = 0;
+  arena.failures = 0;
+
+  if (registeredArenaCount < ARENA_MAX_REGISTERED) {
+    registeredArenas[registeredArenaCount++] = &arena;
+  }
+}
+
+void *arenaAlloc(Arena &arena, size_t size, size_t align) {
+  // Align the address, not just the offset, the buffer may be unaligned
+  uintptr_t start = (uintptr_t)arena.base + arena.used;
+  uintptr_t aligned = (start + align - 1) & ~(uintptr_t)(align - 1);
+  size_t offset = aligned - (uintptr_t)arena.base;
+
+  if (offset > arena.capacity || size > arena.capacity - offset) {
+    arena.failures++;
+    return nullptr;
+  }
+
+  arena.used = offset + size;
+  if (arena.used > arena.highWater) arena.highWater = arena.used;
+  return (void *)aligned;
+}
+
+char *arenaCopyString(Arena &arena, const char *text, size_t length) {
+  char *copy = (char *)arenaAlloc(arena, length + 1, 1);
+  if (copy) {
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+  }
+  return copy;
+}
+
+void arenaReset(Arena &arena) {
+  arena.used = 0;
+}
+
+void arenaRelease(Arena &arena, size_t mark) {
+  if (mark < arena.used) arena.used = mark;
+}
+
+//================================
+// HEAP REPORT
+//================================
+
+// arena is everything ever taken from sbrk, it only grows, so it is the
+// heap high-water mark. uordblks is what is allocated right now. Newlib
+// only has mallinfo(), glibc deprecated it for mallinfo2() (native build).
+static void readHeap(size_t &inUse, size_t &top) {
+#if defined(ARDUINO)
+  struct mallinfo info = mallinfo();
+#else
+  struct mallinfo2 info = mallinfo2();
+#endif
+  inUse = (size_t)info.uordblks;
+  top = (size_t)info.arena;
+}
+
+void heapMarkBoot() {
+  readHeap(heapBootInUse, heapBootTop);
+}
+
+void printHeapReport(Print &out) {
+  size_t inUse, top;
+  readHeap(inUse, top);
+  out.printf("heap_boot_in_use_bytes %lu\n", (unsigned long)heapBootInUse);
+  out.printf("heap_in_use_bytes %lu\n", (unsigned long)inUse);
+  out.printf("heap_high_water_bytes %lu\n", (unsigned long)top);
+  out.printf("heap_growth_since_boot_bytes %lu\n",
+             (unsigned long)(top > heapBootTop ? top - heapBootTop : 0));
+
+  for (int i = 0; i < registeredArenaCount; i++) {
+    const Arena &a = *registeredArenas[i];
+    out.printf("arena_%s_capacity_bytes %lu\n", a.name, (unsigned long)a.capacity);
+    out.printf("arena_%s_high_water_bytes %lu\n", a.name, (unsigned long)a.highWater);
+    out.printf("arena_%s_failures %lu\n", a.name, (unsigned long)a.failures);
+  }
+}
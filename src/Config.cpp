@@ -56,7 +56,16 @@ NetworkConfig netConfig = {
   IPAddress(192, 168, 0, 100),     // sendToIP (OSC target)
   8000,                            // receivePort (OSC listening)
   9000,                            // sendPort (OSC destination)
-  true                             // useDHCP (fallback to static if false)
+  true,                            // useDHCP (fallback to static if false)
+  false                            // sendTcp (UDP by default)
+};
+
+// Extra OSC destinations, all disabled by default
+OscDestination oscDestinations[OSC_MAX_DESTINATIONS] = {
+  { IPAddress(0, 0, 0, 0), 8000, false, false, false },
+  { IPAddress(0, 0, 0, 0), 8000, false, false, false },
+  { IPAddress(0, 0, 0, 0), 8000, false, false, false },
+  { IPAddress(0, 0, 0, 0), 8000, false, false, false },
 };
 
 
@@ -33,9 +33,7 @@ void loadCalibration() {
 void checkCalibration() {
   if (EEPROM.read(EEPROM_CAL_SIGNATURE_ADDR) != CALCFG_EEPROM_SIGNATURE) {
     debugPrint("Running calibration...");
-    calibrateFaders();
-
-    saveCalibration();
+    calibrateFaders();          // Saves the calibration when done
     saveTouchConfig();          // Save default touch configuration as well
   } else {
     loadCalibration();
@@ -94,6 +92,9 @@ void saveNetworkConfig() {
  
   // DHCP flag
   EEPROM.write(addr++, netConfig.useDHCP ? 1 : 0);
+
+  // OSC transport to the console (1 = TCP)
+  EEPROM.write(addr++, netConfig.sendTcp ? 1 : 0);
  
   bool configChanged = false;
   int checkAddr = NETCFG_EEPROM_ADDR + 1; // Skip signature
@@ -146,6 +147,9 @@ bool loadNetworkConfig() {
   EEPROM.get(addr, netConfig.sendPort);    addr += sizeof(uint16_t);
  
   netConfig.useDHCP = EEPROM.read(addr++) ? true : false;
+
+  // Older layouts end here, an erased byte reads 0xFF so only 1 means TCP
+  netConfig.sendTcp = (EEPROM.read(addr++) == 1);
  
 
   debugPrint("Network config loaded from EEPROM.");
@@ -202,6 +206,47 @@ void loadTouchConfig() {
   }
 }
 
+//================================
+// OSC DESTINATION FUNCTIONS
+//================================
+// Per destination: IP (4), port (2), flags (1: bit0 enabled, bit1 broadcast, bit2 TCP), pad (1)
+
+void saveOscDestinations() {
+  int addr = EEPROM_OSCDEST_START;
+  EEPROM.write(addr++, OSCDEST_EEPROM_SIGNATURE);
+
+  for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+    const OscDestination &dest = oscDestinations[d];
+    for (int i = 0; i < 4; i++) EEPROM.write(addr++, dest.ip[i]);
+    EEPROM.put(addr, dest.port); addr += sizeof(uint16_t);
+    EEPROM.write(addr++, (dest.enabled ? 1 : 0) | (dest.broadcast ? 2 : 0) | (dest.tcp ? 4 : 0));
+    EEPROM.write(addr++, 0);
+  }
+
+  debugPrint("OSC destinations saved to EEPROM.");
+}
+
+void loadOscDestinations() {
+  int addr = EEPROM_OSCDEST_START;
+  if (EEPROM.read(addr++) != OSCDEST_EEPROM_SIGNATURE) {
+    debugPrint("No OSC destinations in EEPROM, sending to the main console only.");
+    return;
+  }
+
+  for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+    OscDestination &dest = oscDestinations[d];
+    for (int i = 0; i < 4; i++) dest.ip[i] = EEPROM.read(addr++);
+    EEPROM.get(addr, dest.port); addr += sizeof(uint16_t);
+    uint8_t flags = EEPROM.read(addr++);
+    dest.enabled = flags & 1;
+    dest.broadcast = flags & 2;
+    dest.tcp = flags & 4;
+    addr++;
+  }
+
+  debugPrint("OSC destinations loaded from EEPROM.");
+}
+
 //================================
 // COMBINED CONFIGURATION FUNCTIONS
 //================================
@@ -211,6 +256,7 @@ void loadAllConfig() {
   loadConfig();          // Load fader configuration
   loadNetworkConfig();   // Load network configuration
   loadTouchConfig();     // Load touch sensor configuration
+  loadOscDestinations(); // Load extra OSC destinations
   loadCalibration();
 }
 
@@ -219,9 +265,40 @@ void saveAllConfig() {
   saveFaderConfig();     // Save fader configuration
   saveNetworkConfig();   // Save network configuration
   saveTouchConfig();     // Save touch sensor configuration
+  saveOscDestinations(); // Save extra OSC destinations
   saveCalibration();
 }
 
+//================================
+// SAVE JOURNAL
+//================================
+// Sections are written one at a time, signature first, so a power loss
+// part way through a bulk save would leave some sections new, some old and
+// one possibly torn. The journal keeps the old bytes until the marker is
+// cleared after the last section, which makes the whole save one commit.
+
+void beginConfigJournal() {
+  for (int addr = 0; addr < EEPROM_JOURNAL_SIZE; addr++) {
+    EEPROM.update(EEPROM_JOURNAL_DATA_ADDR + addr, EEPROM.read(addr));
+  }
+  EEPROM.write(EEPROM_JOURNAL_MARKER_ADDR, JOURNAL_EEPROM_SIGNATURE);
+}
+
+void commitConfigJournal() {
+  EEPROM.write(EEPROM_JOURNAL_MARKER_ADDR, 0);
+}
+
+// Call before anything reads the configuration
+void recoverConfigJournal() {
+  if (EEPROM.read(EEPROM_JOURNAL_MARKER_ADDR) != JOURNAL_EEPROM_SIGNATURE) return;
+
+  debugPrint("Interrupted settings save found, restoring the previous settings.");
+  for (int addr = 0; addr < EEPROM_JOURNAL_SIZE; addr++) {
+    EEPROM.update(addr, EEPROM.read(EEPROM_JOURNAL_DATA_ADDR + addr));
+  }
+  commitConfigJournal();
+}
+
 //================================
 // RESET FUNCTIONS
 //================================
@@ -258,9 +335,15 @@ void resetNetworkDefaults() {
   netConfig.sendToIP = IPAddress(192, 168, 0, 100);
   netConfig.receivePort = 8000;
   netConfig.sendPort = 9000;
+  netConfig.sendTcp = false;
+
+  for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+    oscDestinations[d].enabled = false;
+  }
   
   // Save to EEPROM
   saveNetworkConfig();
+  saveOscDestinations();
   
    displayIPAddress();
 
@@ -333,7 +416,8 @@ void dumpEepromConfig() {
     EEPROM.get(addr, receivePort); addr += sizeof(uint16_t);
     EEPROM.get(addr, sendPort); addr += sizeof(uint16_t);
     
-    bool useDHCP = EEPROM.read(addr) ? true : false;
+    bool useDHCP = EEPROM.read(addr++) ? true : false;
+    bool sendTcp = (EEPROM.read(addr) == 1);
     
     debugPrintf("Use DHCP: %s\n", useDHCP ? "Yes" : "No");
     debugPrintf("Static IP: %d.%d.%d.%d\n", staticIP[0], staticIP[1], staticIP[2], staticIP[3]);
@@ -342,6 +426,7 @@ void dumpEepromConfig() {
     debugPrintf("Send-To IP: %d.%d.%d.%d\n", sendToIP[0], sendToIP[1], sendToIP[2], sendToIP[3]);
     debugPrintf("Receive Port: %d\n", receivePort);
     debugPrintf("Send Port: %d\n", sendPort);
+    debugPrintf("Send Transport: %s\n", sendTcp ? "TCP" : "UDP");
   } else {
     debugPrintf("Network config not found (signature=0x%02X, expected=0x%02X)\n",
                EEPROM.read(NETCFG_EEPROM_ADDR), NETCFG_EEPROM_SIGNATURE);
@@ -364,6 +449,24 @@ void dumpEepromConfig() {
   }
   
 
+  // Check extra OSC destinations
+  debugPrint("\n--- Extra OSC Destinations ---");
+  if (EEPROM.read(EEPROM_OSCDEST_START) == OSCDEST_EEPROM_SIGNATURE) {
+    int addr = EEPROM_OSCDEST_START + 1;
+    for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+      uint8_t ip[4];
+      uint16_t port;
+      for (int i = 0; i < 4; i++) ip[i] = EEPROM.read(addr++);
+      EEPROM.get(addr, port); addr += sizeof(uint16_t);
+      uint8_t flags = EEPROM.read(addr++);
+      addr++;
+      debugPrintf("Destination %d: %d.%d.%d.%d:%d %s%s%s\n", d + 1, ip[0], ip[1], ip[2], ip[3], port,
+                 (flags & 1) ? "enabled" : "disabled", (flags & 2) ? " broadcast" : "", (flags & 4) ? " TCP" : "");
+    }
+  } else {
+    debugPrintf("OSC destinations not found (signature=0x%02X, expected=0x%02X)\n",
+               EEPROM.read(EEPROM_OSCDEST_START), OSCDEST_EEPROM_SIGNATURE);
+  }
   
   debugPrint("\n===== END OF EEPROM DUMP =====\n");
 }
\ No newline at end of file
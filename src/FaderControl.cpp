@@ -15,6 +15,7 @@ void driveMotor(Fader& f, int direction) {
     digitalWrite(f.dirPin1, LOW);
     digitalWrite(f.dirPin2, LOW);
     analogWrite(f.pwmPin, 0);
+    f.motorOutput = 0;
     return;
   }
   
@@ -31,6 +32,7 @@ void driveMotor(Fader& f, int direction) {
   
   // Apply PWM speed
   analogWrite(f.pwmPin, Fconfig.defaultPwm);
+  f.motorOutput = direction > 0 ? Fconfig.defaultPwm : -Fconfig.defaultPwm;
   
   if (debugMode) {
     debugPrintf("Fader %d: Motor PWM: %d, Dir: %s, Setpoint: %d\n", 
@@ -45,6 +47,7 @@ void driveMotorWithPWM(Fader& f, int direction, int pwmValue) {
     digitalWrite(f.dirPin1, LOW);
     digitalWrite(f.dirPin2, LOW);
     analogWrite(f.pwmPin, 0);
+    f.motorOutput = 0;
     return;
   }
   
@@ -61,6 +64,7 @@ void driveMotorWithPWM(Fader& f, int direction, int pwmValue) {
   
   // Apply custom PWM speed
   analogWrite(f.pwmPin, pwmValue);
+  f.motorOutput = direction > 0 ? pwmValue : -pwmValue;
   
   if (debugMode) {
     debugPrintf("Fader %d: Motor PWM: %d, Dir: %s, Setpoint: %d\n", 
@@ -101,81 +105,103 @@ int calculateVelocityPWM(int difference) {
 //================================
 // MOVE ALL FADERs TO SETPOINT
 //================================
+// A move is started by moveAllFadersToSetpoints() and then stepped by
+// serviceFaderMotion() from the faders task, one check of every fader per
+// step, so nothing waits for the motors to arrive.
 
-void moveAllFadersToSetpoints() {
-  bool allFadersAtTarget = false;
-  unsigned long moveStartTime = millis();
+static bool motionActive = false;
+static unsigned long motionStartTime = 0;
+static unsigned long lastMotionStep = 0;
 
-  while (!allFadersAtTarget) {
-    allFadersAtTarget = true; // Assume all are at target until proven otherwise
-    
+// One pass over all faders, returns true when every one is at its setpoint
+static bool stepFaderMotion() {
+  bool allFadersAtTarget = true; // Assume all are at target until proven otherwise
+  lastMotionStep = micros();
 
-    for (int i = 0; i < NUM_FADERS; i++) {
-      Fader& f = faders[i];
-      
-      // Read current position as OSC value
-      int currentOscValue = readFadertoOSC(f);
-      
-      // Setpoint is already in OSC units (0-100)
-      int targetOscValue = (int)f.setpoint;
-      
-      // Calculate difference in OSC units
-      int difference = targetOscValue - currentOscValue;
-      
-      // Check if we need to move this fader (using a smaller tolerance for OSC units) IF NOT TOUCHING IT
-      if (abs(difference) > Fconfig.targetTolerance && !f.touched) {
-        allFadersAtTarget = false; // At least one fader is not at target
-        
-        
+  for (int i = 0; i < NUM_FADERS; i++) {
+    Fader& f = faders[i];
 
-        if (difference > 0) {
-          // Need to move up
-          int pwm = calculateVelocityPWM(difference);
-          driveMotorWithPWM(f, 1, pwm);
-        } else {
-          // Need to move down  
-          int pwm = calculateVelocityPWM(difference);
-          driveMotorWithPWM(f, -1, pwm);
-        }
+    // The calibration job drives this one itself
+    if (f.calibrating) continue;
 
+    // Read current position as OSC value
+    int currentOscValue = readFadertoOSC(f);
 
+    // Setpoint is already in OSC units (0-100)
+    int targetOscValue = (int)f.setpoint;
 
-        if (debugMode) {
-          debugPrintf("Fader %d: Current OSC: %d, Target OSC: %d, Diff: %d\n", 
-                     f.oscID, currentOscValue, targetOscValue, difference);
-        }
+    // Calculate difference in OSC units
+    int difference = targetOscValue - currentOscValue;
 
-        } else {
-          // Fader is at target, stop motor
-          driveMotorWithPWM(f, 0, 0);
-        }
+    // Check if we need to move this fader (using a smaller tolerance for OSC units) IF NOT TOUCHING IT
+    if (abs(difference) > Fconfig.targetTolerance && !f.touched) {
+      allFadersAtTarget = false; // At least one fader is not at target
+
+      int pwm = calculateVelocityPWM(difference);
+      driveMotorWithPWM(f, difference > 0 ? 1 : -1, pwm);
 
-    }
-    
-    // Small delay to prevent overwhelming the system
-    delay(5);
-    
-    // Optional: Add timeout protection to prevent infinite loops
-    if (millis() - moveStartTime > 2000) { // 10 second timeout
-      // Stop all motors if we've been trying for too long
-      for (int i = 0; i < NUM_FADERS; i++) {
-        driveMotor(faders[i], 0);
-      }
       if (debugMode) {
-        debugPrintf("Fader movement timeout - stopping all motors\n");
+        debugPrintf("Fader %d: Current OSC: %d, Target OSC: %d, Diff: %d\n",
+                   f.oscID, currentOscValue, targetOscValue, difference);
       }
-      break;
+    } else {
+      // Fader is at target, stop motor
+      driveMotorWithPWM(f, 0, 0);
     }
   }
-  
-  if (debugMode && allFadersAtTarget) {
-    debugPrintf("All faders have reached their setpoints\n");
+
+  return allFadersAtTarget;
+}
+
+static void stopFaderMotion() {
+  for (int i = 0; i < NUM_FADERS; i++) {
+    if (!faders[i].calibrating) driveMotor(faders[i], 0);
+  }
+  motionActive = false;
+}
+
+// Starts a move (or restarts the timeout of the one under way) and takes
+// the first step right away
+void moveAllFadersToSetpoints() {
+  motionActive = true;
+  motionStartTime = millis();
+
+  if (stepFaderMotion()) {
+    motionActive = false;
   }
 }
 
+void serviceFaderMotion() {
+  if (!motionActive) return;
+  if (micros() - lastMotionStep < FADER_MOTION_STEP_US) return;
+
+  if (stepFaderMotion()) {
+    motionActive = false;
+    if (debugMode) {
+      debugPrintf("All faders have reached their setpoints\n");
+    }
+    return;
+  }
+
+  // Timeout protection, a fader that cannot reach its setpoint stops here
+  if (millis() - motionStartTime > FADER_MOTION_TIMEOUT_MS) {
+    stopFaderMotion();
+    if (debugMode) {
+      debugPrintf("Fader movement timeout - stopping all motors\n");
+    }
+  }
+}
+
+bool faderMotionActive() {
+  return motionActive;
+}
+
 // Function to set a new setpoint for a specific fader (called when OSC message received)
 void setFaderSetpoint(int faderIndex, int oscValue) {
   if (faderIndex >= 0 && faderIndex < NUM_FADERS) {
+    // Kept for later while the calibration job holds this fader
+    if (calibrationHoldSetpoint(faderIndex, oscValue)) return;
+
     // Store the OSC value (0-100) directly as setpoint
     faders[faderIndex].setpoint = constrain(oscValue, 0, 100);
     
@@ -189,10 +215,12 @@ void setFaderSetpoint(int faderIndex, int oscValue) {
 
 
 void handleFaders() {
+  serviceFaderMotion();
+
   for (int i = 0; i < NUM_FADERS; i++) {
     Fader& f = faders[i];
 
-    if (!f.touched){    
+    if (!f.touched || f.calibrating){    
       continue;
     }
 
@@ -206,13 +234,8 @@ void handleFaders() {
     if (abs(currentOscValue - f.lastReportedValue) >= Fconfig.sendTolerance || forceSend) {
         f.lastReportedValue = currentOscValue;
         
-        // If forcesend because fast move to top or bottom then ignore rate limiting
-        if (forceSend) {
-          sendOscUpdate(f, currentOscValue, true);
-        } else {
-          sendOscUpdate(f, currentOscValue, false);
-        }
-
+        // Rate limited values are held and sent later by serviceOscRateLimiter()
+        sendOscUpdate(f, currentOscValue, forceSend);
 
         f.setpoint = currentOscValue;
 
@@ -221,32 +244,34 @@ void handleFaders() {
         }
     }
     }
+
+  // Flush values the rate limiter held back, even after the fader is released
+  serviceOscRateLimiter();
   }
 
 
 
 
 
-// Read fader analog pin and return OSC value (0-100) using fader's calibrated range, with clamping at both ends
+// Read fader analog pin and return OSC value (0-100) using fader's calibrated range
 int readFadertoOSC(Fader& f) {
   int analogValue = analogRead(f.analogPin);
+  f.current = analogValue;
+  return analogToOSC(analogValue, f.minVal, f.maxVal);
+}
 
+// Analog reading to OSC value (0-100) for a calibrated range, with clamping at both ends
+int analogToOSC(int analogValue, int minVal, int maxVal) {
   // Clamp near-bottom analog values to force OSC = 0
-  if (analogValue <= f.minVal + 15) {
-    if (debugMode) {
-      //debugPrintf("Fader %d: Clamped to 0 (analog=%d, minVal=%d)\n", f.oscID, analogValue, f.minVal);
-    }
+  if (analogValue <= minVal + 15) {
     return 0;
   }
 
   // Clamp near-top analog values to force OSC = 100
-  if (analogValue >= f.maxVal - 15) {
-    if (debugMode) {
-      //debugPrintf("Fader %d: Clamped to 100 (analog=%d, maxVal=%d)\n", f.oscID, analogValue, f.maxVal);
-    }
+  if (analogValue >= maxVal - 15) {
     return 100;
   }
 
-  int oscValue = map(analogValue, f.minVal, f.maxVal, 0, 100);
+  int oscValue = map(analogValue, minVal, maxVal, 0, 100);
   return constrain(oscValue, 0, 100);
-}
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+// FormParser.cpp
+
+#include "FormParser.h"
+
+//================================
+// PARSING
+//================================
+
+static int hexDigit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+void formClear(FormData &form) {
+  form.count = 0;
+  form.truncated = false;
+}
+
+void formParse(FormData &form, char *data, size_t length) {
+  const char *in = data;
+  const char *end = data + length;
+  char *out = data;   // Decoding only shrinks, so out never passes in
+
+  while (in < end) {
+    char *key = out;
+    char *value = nullptr;
+
+    while (in < end && *in != '&') {
+      char c = *in++;
+      if (c == '=' && value == nullptr) {
+        *out++ = '\0';
+        value = out;
+        continue;
+      }
+      if (c == '+') {
+        c = ' ';
+      } else if (c == '%' && end - in >= 2) {
+        int hi = hexDigit(in[0]);
+        int lo = hexDigit(in[1]);
+        if (hi >= 0 && lo >= 0) {
+          c = (char)((hi << 4) | lo);
+          in += 2;
+        }
+      }
+      *out++ = c;
+    }
+
+    *out++ = '\0';
+    if (in < end) in++;   // Skip '&'
+
+    if (value == nullptr) {
+      if (key[0] == '\0') continue;   // "&&" or a trailing '&'
+      value = out - 1;                // Key without '=', empty value
+    }
+
+    if (form.count < FORM_MAX_FIELDS) {
+      form.fields[form.count].key = key;
+      form.fields[form.count].value = value;
+      form.count++;
+    } else {
+      form.truncated = true;
+    }
+  }
+}
+
+const char *formGet(const FormData &form, const char *key) {
+  for (int i = form.count - 1; i >= 0; i--) {
+    if (strcmp(form.fields[i].key, key) == 0) return form.fields[i].value;
+  }
+  return nullptr;
+}
+
+//================================
+// CONVERSIONS
+//================================
+
+bool formParseInt(const char *text, long &value) {
+  if (text == nullptr || text[0] == '\0') return false;
+  char *endPtr;
+  value = strtol(text, &endPtr, 10);
+  return *endPtr == '\0';
+}
+
+bool formParseIP(const char *text, IPAddress &ip) {
+  uint8_t octets[4];
+  const char *p = text;
+
+  for (int i = 0; i < 4; i++) {
+    if (*p < '0' || *p > '9') return false;
+    int octet = 0;
+    int digits = 0;
+    while (*p >= '0' && *p <= '9') {
+      octet = octet * 10 + (*p++ - '0');
+      if (++digits > 3 || octet > 255) return false;
+    }
+    octets[i] = octet;
+    if (i < 3 && *p++ != '.') return false;
+  }
+  if (*p != '\0') return false;
+
+  ip = IPAddress(octets[0], octets[1], octets[2], octets[3]);
+  return true;
+}
+
+//================================
+// BINDING
+//================================
+
+const char *formBind(const FormData &form, const FormBinding *bindings, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    const FormBinding &binding = bindings[i];
+    const char *text = formGet(form, binding.key);
+
+    if (binding.type == FORM_CHECKBOX) {
+      *(bool *)binding.target = text != nullptr && strcmp(text, "0") != 0;
+      continue;
+    }
+    if (text == nullptr || text[0] == '\0') continue;
+
+    if (binding.type == FORM_IP) {
+      if (!formParseIP(text, *(IPAddress *)binding.target)) return binding.key;
+      continue;
+    }
+
+    long value;
+    if (!formParseInt(text, value) || value < binding.minValue || value > binding.maxValue) {
+      return binding.key;
+    }
+    switch (binding.type) {
+      case FORM_UINT8:  *(uint8_t *)binding.target = value;  break;
+      case FORM_UINT16: *(uint16_t *)binding.target = value; break;
+      case FORM_INT:    *(int *)binding.target = value;      break;
+      default: break;
+    }
+  }
+  return nullptr;
+}
@@ -0,0 +1,97 @@
+// LatencyStats.cpp
+
+#include "LatencyStats.h"
+
+//================================
+// HISTOGRAM INSTANCES
+//================================
+
+LatencyHistogram oscToMotorLatency = { "OSC in -> motor start" };
+LatencyHistogram touchToOscLatency = { "Touch -> OSC out" };
+
+static LatencyHistogram *const allHistograms[] = { &oscToMotorLatency, &touchToOscLatency };
+static const int histogramCount = sizeof(allHistograms) / sizeof(allHistograms[0]);
+
+//================================
+// RECORDING
+//================================
+
+static int bucketFor(uint32_t us) {
+  if (us < 32) return 0;
+  int bucket = (31 - __builtin_clz(us)) - 4;   // 32..63 -> 1, 64..127 -> 2 ...
+  return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+}
+
+void latencyRecord(LatencyHistogram &h, uint32_t us) {
+  h.buckets[bucketFor(us)]++;
+  if (h.count == 0 || us < h.minUs) h.minUs = us;
+  if (us > h.maxUs) h.maxUs = us;
+  h.totalUs += us;
+  h.count++;
+}
+
+void latencyReset(LatencyHistogram &h) {
+  for (int i = 0; i < LATENCY_BUCKETS; i++) h.buckets[i] = 0;
+  h.count = 0;
+  h.minUs = 0;
+  h.maxUs = 0;
+  h.totalUs = 0;
+}
+
+void resetLatencyStats() {
+  for (int i = 0; i < histogramCount; i++) {
+    latencyReset(*allHistograms[i]);
+  }
+}
+
+//================================
+// QUERIES
+//================================
+
+uint32_t latencyBucketLimit(int bucket) {
+  if (bucket >= LATENCY_BUCKETS - 1) return 0;
+  return 32UL << bucket;
+}
+
+uint32_t latencyPercentile(const LatencyHistogram &h, int percent) {
+  if (h.count == 0) return 0;
+
+  uint32_t target = ((uint64_t)h.count * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (int i = 0; i < LATENCY_BUCKETS; i++) {
+    seen += h.buckets[i];
+    if (seen >= target) {
+      uint32_t limit = latencyBucketLimit(i);
+      return limit ? limit : h.maxUs;
+    }
+  }
+  return h.maxUs;
+}
+
+uint32_t latencyAverage(const LatencyHistogram &h) {
+  return h.count ? (uint32_t)(h.totalUs / h.count) : 0;
+}
+
+//================================
+// REPORTING
+//================================
+
+void printLatencyStats(Print &out) {
+  for (int i = 0; i < histogramCount; i++) {
+    const LatencyHistogram &h = *allHistograms[i];
+    out.printf("[LATENCY] %s: n=%lu min=%lu avg=%lu p50<%lu p99<%lu max=%lu us\n",
+               h.name, (unsigned long)h.count, (unsigned long)h.minUs,
+               (unsigned long)latencyAverage(h), (unsigned long)latencyPercentile(h, 50),
+               (unsigned long)latencyPercentile(h, 99), (unsigned long)h.maxUs);
+
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+      if (h.buckets[b] == 0) continue;
+      uint32_t limit = latencyBucketLimit(b);
+      if (limit) {
+        out.printf("  < %7lu us: %lu\n", (unsigned long)limit, (unsigned long)h.buckets[b]);
+      } else {
+        out.printf("  >= %6lu us: %lu\n", (unsigned long)latencyBucketLimit(b - 1), (unsigned long)h.buckets[b]);
+      }
+    }
+  }
+}
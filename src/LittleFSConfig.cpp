@@ -2,6 +2,7 @@
 //We are not using this code yet
 
 #include "LittleFSConfig.h"
+#include "FixedString.h"
 
 static LittleFS_QSPIFlash flashFS;
 
@@ -46,7 +47,9 @@ bool LittleFSConfig::loadConfig() {
     file.close();
 
     if (error) {
-        printError("load", ("JSON parse error: " + String(error.c_str())).c_str());
+        FixedString<64> message;
+        message.printf("JSON parse error: %s", error.c_str());
+        printError("load", message.c_str());
         return false;
     }
 
@@ -0,0 +1,103 @@
+// Metrics.cpp
+
+#include "Metrics.h"
+#include "OLED.h"
+#include "Arena.h"
+#include "Scheduler.h"
+#include "Profiler.h"
+
+//================================
+// STORAGE
+//================================
+
+NetMetrics netMetrics = { 0 };
+HandlerTiming handlerTimings[TIMING_COUNT] = { };
+
+static const char *const handlerNames[TIMING_COUNT] = {
+  "osc_receive",
+  "osc_dispatch",
+  "fader_update",
+  "fader_delta",
+  "motion",
+  "osc_flush",
+  "loop",
+};
+
+static unsigned long lastMetricsDisplay = 0;
+static bool showProfileLine = false;   // Alternates with the IO line
+
+//================================
+// RECORDING
+//================================
+
+void metricsRecordTiming(MetricsHandler handler, uint32_t cycles) {
+  HandlerTiming &t = handlerTimings[handler];
+  if (t.calls == 0 || cycles < t.minCycles) t.minCycles = cycles;
+  if (cycles > t.maxCycles) t.maxCycles = cycles;
+  t.totalCycles += cycles;
+  t.calls++;
+}
+
+void resetMetrics() {
+  memset(&netMetrics, 0, sizeof(netMetrics));
+  memset(handlerTimings, 0, sizeof(handlerTimings));
+  resetTaskStats();
+}
+
+static uint32_t cyclesToMicros(uint64_t cycles) {
+  return (uint32_t)(cycles / (F_CPU_ACTUAL / 1000000));
+}
+
+//================================
+// REPORTING
+//================================
+
+void printMetrics(Print &out) {
+  out.printf("uptime_ms %lu\n", millis());
+  out.printf("net_packets_in %lu\n", (unsigned long)netMetrics.packetsIn);
+  out.printf("net_bytes_in %lu\n", (unsigned long)netMetrics.bytesIn);
+  out.printf("net_packets_out %lu\n", (unsigned long)netMetrics.packetsOut);
+  out.printf("net_bytes_out %lu\n", (unsigned long)netMetrics.bytesOut);
+  out.printf("osc_parse_errors %lu\n", (unsigned long)netMetrics.parseErrors);
+  out.printf("osc_bundle_errors %lu\n", (unsigned long)netMetrics.bundleErrors);
+  out.printf("osc_unknown_address %lu\n", (unsigned long)netMetrics.unknownAddress);
+  out.printf("osc_pings %lu\n", (unsigned long)netMetrics.pings);
+  out.printf("telemetry_frames %lu\n", (unsigned long)netMetrics.telemetryFrames);
+  out.printf("telemetry_dropped %lu\n", (unsigned long)netMetrics.telemetryDropped);
+
+  for (int i = 0; i < TIMING_COUNT; i++) {
+    const HandlerTiming &t = handlerTimings[i];
+    uint32_t avg = t.calls ? cyclesToMicros(t.totalCycles / t.calls) : 0;
+    out.printf("time_%s_calls %lu\n", handlerNames[i], (unsigned long)t.calls);
+    out.printf("time_%s_min_us %lu\n", handlerNames[i], (unsigned long)cyclesToMicros(t.minCycles));
+    out.printf("time_%s_avg_us %lu\n", handlerNames[i], (unsigned long)avg);
+    out.printf("time_%s_max_us %lu\n", handlerNames[i], (unsigned long)cyclesToMicros(t.maxCycles));
+  }
+
+  printTaskStats(out);
+  printHeapReport(out);
+}
+
+// One line under the IP addresses: packets in/out, errors, slowest receive pass
+void updateMetricsDisplay() {
+#if METRICS_OLED_INTERVAL_MS > 0
+  unsigned long now = millis();
+  if (now - lastMetricsDisplay < METRICS_OLED_INTERVAL_MS) return;
+  lastMetricsDisplay = now;
+
+  char line[48];   // Fits four full 32 bit counters, the OLED clips the rest
+  showProfileLine = !showProfileLine;
+  if (showProfileLine && formatProfileLine(line, sizeof(line))) {
+    display.showString("PR", line, 2);
+    display.display();
+    return;
+  }
+
+  snprintf(line, sizeof(line), "%lu/%lu E%lu %luus",
+           (unsigned long)netMetrics.packetsIn, (unsigned long)netMetrics.packetsOut,
+           (unsigned long)(netMetrics.parseErrors + netMetrics.bundleErrors + netMetrics.unknownAddress),
+           (unsigned long)cyclesToMicros(handlerTimings[TIMING_OSC_RECEIVE].maxCycles));
+  display.showString("IO", line, 2);
+  display.display();
+#endif
+}
@@ -1,6 +1,13 @@
 // NetworkOSC.cpp
 
 #include "NetworkOSC.h"
+#include "OSCRouter.h"
+#include "OSCWriter.h"
+#include "PageCache.h"
+#include "LatencyStats.h"
+#include "Metrics.h"
+#include "Profiler.h"
+#include "SlipCodec.h"
 #include "Utils.h"
 #include "FaderControl.h"
 #include "Config.h"
@@ -13,6 +20,18 @@
 
 EthernetUDP udp;
 
+// Outgoing packets are encoded straight into this buffer
+static uint8_t oscTxBuffer[OSC_TX_BUFFER_SIZE];
+static OscWriter oscTx(oscTxBuffer, sizeof(oscTxBuffer));
+
+// Outgoing message/datagram counters, messages - packets = packets saved by bundling
+static OscOutputStats oscOutputStats = { 0, 0 };
+static unsigned long oscBatchStartTime = 0;
+
+// Precomputed "/PageN/FaderN" addresses, rebuilt when the page changes
+static OscAddress faderOscAddress[NUM_FADERS];
+static int faderOscAddressPage = -1;
+
 
 //================================
 // NETWORK SETUP
@@ -44,6 +63,9 @@ void setupNetwork() {
   // Set up mDNS for service discovery
   MDNS.begin(kServiceName);
   MDNS.addService("_osc", "_udp", netConfig.receivePort);
+
+  // OSC over TCP on the same port
+  startOscTcp();
   debugPrint("OSC and mDNS initialized");
 }
 
@@ -61,54 +83,462 @@ void restartUDP() {
 
   // Re-register mDNS if needed
   MDNS.addService("_osc", "_udp", netConfig.receivePort);
+
+  // Reopen TCP with the new port and destinations
+  closeOscTcpLinks();
+  startOscTcp();
 }
 
 
 
 
+//================================
+// OSC ID LOOKUP
+//================================
+// Direct table from executor OSC ID (e.g. 201) to fader index, -1 if unused
+static int8_t faderIndexByOscID[OSC_ID_LOOKUP_SIZE];
+
+void buildFaderIdLookup() {
+  memset(faderIndexByOscID, -1, sizeof(faderIndexByOscID));
+  for (int i = 0; i < NUM_FADERS; i++) {
+    if (faders[i].oscID < OSC_ID_LOOKUP_SIZE) {
+      faderIndexByOscID[faders[i].oscID] = i;
+    } else {
+      debugPrintf("Fader %d OSC ID %d outside lookup table\n", i, faders[i].oscID);
+    }
+  }
+}
+
 // Returns the index of the fader with the given OSC ID, or -1 if not found
 int getFaderIndexFromID(int id) {
+  if (id < 0 || id >= OSC_ID_LOOKUP_SIZE) return -1;
+  return faderIndexByOscID[id];
+}
+
+//================================
+// PENDING SETPOINTS
+//================================
+// Setpoints received during one handleOscMessage() pass. Several packets for the
+// same fader can arrive in one pass, only the newest value is kept and the motors
+// are driven once after the socket has been drained.
+static int pendingSetpoint[NUM_FADERS];
+static bool pendingSetpointValid[NUM_FADERS] = { false };
+
+// When the packet being dispatched was read (or a scheduled message released),
+// kept per setpoint for the OSC in -> motor start latency histogram
+static unsigned long oscPacketRxMicros = 0;
+static unsigned long pendingSetpointRxMicros[NUM_FADERS];
+
+void queueFaderSetpoint(int faderIndex, int oscValue) {
+  if (faderIndex < 0 || faderIndex >= NUM_FADERS) return;
+  pendingSetpoint[faderIndex] = oscValue;
+  pendingSetpointValid[faderIndex] = true;
+  pendingSetpointRxMicros[faderIndex] = oscPacketRxMicros;
+}
+
+void applyPendingSetpoints() {
+  bool needToMoveFaders = false;
+  unsigned long now = micros();
+
   for (int i = 0; i < NUM_FADERS; i++) {
-    if (faders[i].oscID == id) {
-      return i;
+    if (!pendingSetpointValid[i]) continue;
+    pendingSetpointValid[i] = false;
+
+    // Held by the calibration job, which applies it when the run ends
+    if (faders[i].calibrating) {
+      setFaderSetpoint(i, pendingSetpoint[i]);
+      continue;
+    }
+
+    // Fader may have been grabbed since the value was queued
+    if (faders[i].touched) continue;
+
+    // Always keep the newest target (the page cache is built from it), the
+    // tolerance only decides whether the motors need to start
+    setFaderSetpoint(i, pendingSetpoint[i]);
+
+    int currentOscValue = readFadertoOSC(faders[i]);
+    if (abs(pendingSetpoint[i] - currentOscValue) > Fconfig.targetTolerance) {
+      debugPrintf("Updating fader %d setpoint: %d -> %d\n", faders[i].oscID, currentOscValue, pendingSetpoint[i]);
+      latencyRecord(oscToMotorLatency, now - pendingSetpointRxMicros[i]);
+      needToMoveFaders = true;
     }
   }
-  return -1;
+
+  // Move all faders to their new setpoints if any changed
+  if (needToMoveFaders) {
+    debugPrint("Moving faders to new setpoints");
+    PROFILE_ZONE("motion");
+    uint32_t motionStart = ARM_DWT_CYCCNT;
+    moveAllFadersToSetpoints();
+    metricsRecordTiming(TIMING_MOTION, ARM_DWT_CYCCNT - motionStart);
+  }
 }
 
-// Handles fader movement OSC messages
-void handleOscMovement(const char *address, int value) {
-  int pageNum = -1;
-  int faderID = -1;
+// Handles fader movement OSC messages (/PageN/FaderN)
+void handleOscMovement(int pageNum, int faderID, int value) {
+  // If we received a message for a different page, update current page
+  if (pageNum != currentOSCPage) {
+    debugPrintf("Page changed from %d to %d (via fader message)\n", currentOSCPage, pageNum);
+  }
+  setCurrentOscPage(pageNum);
+  
+  int faderIndex = getFaderIndexFromID(faderID);  
+  if (faderIndex < 0) return;
+
+  if (faders[faderIndex].touched) return;   //if touched then don't update using osc or we will get feedback
 
-  // Extract both page number and fader ID from the OSC address
-  if (sscanf(address, "/Page%d/Fader%d", &pageNum, &faderID) == 2) {
-    
-    // If we received a message for a different page, update current page
-    if (pageNum != currentOSCPage) {
-      debugPrintf("Page changed from %d to %d (via fader message)\n", currentOSCPage, pageNum);
+  debugPrintf("Fader %d new setpoint %d (via fader message)\n", faderID, value);
+  queueFaderSetpoint(faderIndex, value); // oscValue is 0-100, applied after the receive loop
+}
+
+
+// function to handle page update messages (/updatePage/current)
+void handlePageUpdate(int value) {
+  if (value != currentOSCPage) {
+    debugPrintf("Page changed from %d to %d (via updatePage command)\n", currentOSCPage, value);
+  }
+  setCurrentOscPage(value);
+}
+
+//================================
+// OSC OVER TCP
+//================================
+// OSC 1.1 stream transport, SLIP framed packets over TCP. Links to TCP
+// destinations are opened on first use and retried every OSC_TCP_RETRY_MS,
+// inbound connections are accepted on the receive port. Frames from any
+// link go through the same dispatcher as UDP packets.
+
+struct OscTcpLink {
+  EthernetClient client;
+  uint8_t rxBuffer[OSC_SLIP_MAX_FRAME];
+  SlipDecoder decoder{ rxBuffer, sizeof(rxBuffer) };
+  bool configured;              // Nagle off and decoder reset for this connection
+  unsigned long lastAttempt;    // Last connect attempt (outbound links)
+};
+
+// Outbound links use the destination stats index, 0 = main console
+static OscTcpLink oscTcpOut[1 + OSC_MAX_DESTINATIONS];
+static OscTcpLink oscTcpIn[OSC_TCP_MAX_CLIENTS];
+static EthernetServer oscTcpServer;
+static uint8_t oscSlipTxBuffer[SLIP_ENCODED_MAX(OSC_TX_BUFFER_SIZE)];
+
+static void configureTcpLink(OscTcpLink &link) {
+  if (link.configured) return;
+  link.client.setNoDelay(true);   // Small packets go out now, no Nagle wait
+  link.decoder.reset();
+  link.configured = true;
+}
+
+// Send one packet, false if the link is not up yet or has no room.
+// Never waits: a full send buffer drops the packet like UDP would.
+static bool sendTcpPacket(int index, IPAddress ip, uint16_t port, const uint8_t *data, size_t size) {
+  OscTcpLink &link = oscTcpOut[index];
+
+  if (!link.client.connected()) {
+    link.configured = false;
+    unsigned long now = millis();
+    if (link.lastAttempt == 0 || now - link.lastAttempt >= OSC_TCP_RETRY_MS) {
+      link.lastAttempt = now | 1;
+      link.client.connectNoWait(ip, port);
+      debugPrintf("[OSC] Connecting TCP to %u.%u.%u.%u:%u\n", ip[0], ip[1], ip[2], ip[3], port);
     }
-    currentOSCPage = pageNum;
-    
-    int faderIndex = getFaderIndexFromID(faderID);  
+    return false;
+  }
+  configureTcpLink(link);
+
+  size_t encoded = slipEncode(data, size, oscSlipTxBuffer, sizeof(oscSlipTxBuffer));
+  if (encoded == 0 || link.client.availableForWrite() < (int)encoded) return false;
+
+  link.client.write(oscSlipTxBuffer, encoded);
+  link.client.flush();
+  return true;
+}
 
-    if (faders[faderIndex].touched) return;   //if touched then don't update using osc or we will get feedback
+// Decode whatever a link has buffered, returns the bytes consumed
+static int readTcpLink(OscTcpLink &link, int budget) {
+  uint8_t chunk[128];
+  int consumed = 0;
+
+  while (consumed < budget) {
+    int available = link.client.available();
+    if (available <= 0) break;
+    if (available > (int)sizeof(chunk)) available = sizeof(chunk);
+
+    int n = link.client.read(chunk, available);
+    if (n <= 0) break;
+    consumed += n;
+
+    for (int i = 0; i < n; i++) {
+      if (!link.decoder.feed(chunk[i])) continue;
+      oscPacketRxMicros = micros();
+      netMetrics.packetsIn++;
+      netMetrics.bytesIn += link.decoder.size();
+      dispatchOscPacket(link.decoder.data(), link.decoder.size());
+    }
+  }
+  return consumed;
+}
+
+void startOscTcp() {
+#if OSC_TCP_LISTEN
+  oscTcpServer.end();
+  oscTcpServer.begin(netConfig.receivePort);
+  MDNS.addService("_osc", "_tcp", netConfig.receivePort);
+#endif
+}
 
-            // When you receive an OSC message:
-            debugPrintf("Fader %d new setpoint %d (via fader message)\n", faderID, value);
-      setFaderSetpoint(faderIndex, value); // oscValue is 0-100
-      moveAllFadersToSetpoints(); // This will move all faders as needed
+// Drop every link, outbound ones reconnect on the next send with the
+// current destination settings
+void closeOscTcpLinks() {
+  for (OscTcpLink &link : oscTcpOut) {
+    link.client.stop();
+    link.configured = false;
+    link.lastAttempt = 0;
+  }
+  for (OscTcpLink &link : oscTcpIn) {
+    link.client.stop();
+    link.configured = false;
   }
 }
 
+// Accept new connections and decode received frames, called from handleOscMessage()
+void serviceOscTcp() {
+#if OSC_TCP_LISTEN
+  EthernetClient incoming = oscTcpServer.accept();
+  if (incoming) {
+    OscTcpLink *slot = nullptr;
+    for (OscTcpLink &link : oscTcpIn) {
+      if (!link.client.connected()) {
+        slot = &link;
+        break;
+      }
+    }
+    if (slot) {
+      slot->client = incoming;
+      slot->configured = false;
+      configureTcpLink(*slot);
+      debugPrint("[OSC] TCP client connected");
+    } else {
+      incoming.stop();
+      debugPrint("[OSC] TCP client refused, all slots in use");
+    }
+  }
+#endif
 
-// function to handle page update messages
-void handlePageUpdate(const char *address, int value) {
-  if (strstr(address, "/updatePage/current") != NULL) {
-    if (value != currentOSCPage) {
-      debugPrintf("Page changed from %d to %d (via updatePage command)\n", currentOSCPage, value);
+  int budget = OSC_TCP_RX_BUDGET;
+  for (OscTcpLink &link : oscTcpIn) {
+    if (budget <= 0) return;
+    if (link.client.connected()) budget -= readTcpLink(link, budget);
+  }
+  for (OscTcpLink &link : oscTcpOut) {
+    if (budget <= 0) return;
+    if (link.client.connected()) {
+      configureTcpLink(link);
+      budget -= readTcpLink(link, budget);
     }
-    currentOSCPage = value;
+  }
+}
+
+//================================
+// OSC OUTPUT
+//================================
+
+// Rebuild the fader address templates for the current page
+void updateFaderOscAddresses() {
+  for (int i = 0; i < NUM_FADERS; i++) {
+    oscAddressFormat(faderOscAddress[i], "/Page%d/Fader%d", currentOSCPage, faders[i].oscID);
+  }
+  faderOscAddressPage = currentOSCPage;
+}
+
+void setCurrentOscPage(int page) {
+  if (page != currentOSCPage) {
+    // Remember the page we are leaving and start moving to the cached state
+    // of the new one, the console's next update reconciles any difference
+    pageCacheStore(currentOSCPage);
+    currentOSCPage = page;
+    pageCacheRecall(page);
+  }
+  if (faderOscAddressPage != page) {
+    updateFaderOscAddresses();
+  }
+}
+
+static OscDestinationStats oscDestinationStats[1 + OSC_MAX_DESTINATIONS];
+
+const OscDestinationStats &getOscDestinationStats(int index) {
+  return oscDestinationStats[constrain(index, 0, OSC_MAX_DESTINATIONS)];
+}
+
+// Send one packet to a destination (index as in the stats) over UDP or TCP
+static void sendToDestination(int index, IPAddress ip, uint16_t port, bool tcp,
+                              const uint8_t *data, size_t size) {
+  OscDestinationStats &stats = oscDestinationStats[index];
+  bool sent;
+
+  if (tcp) {
+    sent = sendTcpPacket(index, ip, port, data, size);
+  } else {
+    udp.beginPacket(ip, port);
+    udp.write(data, size);
+    sent = udp.endPacket();
+  }
+
+  if (sent) {
+    stats.packets++;
+    stats.bytes += size;
+    netMetrics.packetsOut++;
+    netMetrics.bytesOut += size;
+  } else {
+    stats.errors++;
+  }
+}
+
+// Put one encoded packet on the wire for the main console and every
+// enabled extra destination, the same buffer is sent to each
+static void transmitOscPacket(const uint8_t *data, size_t size) {
+  sendToDestination(0, netConfig.sendToIP, netConfig.sendPort, netConfig.sendTcp, data, size);
+
+  for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+    const OscDestination &dest = oscDestinations[d];
+    if (!dest.enabled) continue;
+    if (dest.broadcast) {
+      sendToDestination(1 + d, Ethernet.broadcastIP(), dest.port, false, data, size);
+    } else {
+      sendToDestination(1 + d, dest.ip, dest.port, dest.tcp, data, size);
+    }
+  }
+  oscOutputStats.packets++;
+
+  // First value after a touch has now left the device
+  unsigned long now = micros();
+  for (int i = 0; i < NUM_FADERS; i++) {
+    if (!faders[i].touchLatencyQueued) continue;
+    faders[i].touchLatencyQueued = false;
+    latencyRecord(touchToOscLatency, now - faders[i].touchStartMicros);
+  }
+}
+
+// Start a new outgoing message and return the writer to encode it with.
+// With OSC_BATCH_OUTPUT the message is appended to the bundle for this tick,
+// otherwise the TX buffer is reset. Finish with endOscMessage(), and encode
+// again from beginOscMessage() when it returns false:
+//
+//   do {
+//     OscWriter &w = beginOscMessage();
+//     w.beginMessage(address, ",i");
+//     w.addInt(value);
+//   } while (!endOscMessage());
+OscWriter &beginOscMessage() {
+#if OSC_BATCH_OUTPUT
+  // Flush early when the next message might not fit under the size cap
+  if (oscTx.messageCount() > 0 && oscTx.remaining() < OSC_BATCH_MSG_RESERVE) {
+    flushOscOutput(true);
+  }
+  if (!oscTx.isBundle()) {
+    oscTx.beginBundle();
+    oscBatchStartTime = millis();
+  }
+#else
+  oscTx.reset();
+#endif
+  return oscTx;
+}
+
+// Returns false when the message did not fit behind the ones already
+// batched: those were sent and the caller encodes it again into an empty
+// bundle. Only a message too large on its own is dropped.
+bool endOscMessage() {
+  if (!oscTx.endMessage()) {
+    oscTx.rollbackMessage();
+#if OSC_BATCH_OUTPUT
+    if (oscTx.messageCount() > 0) {
+      flushOscOutput(true);
+      return false;
+    }
+#endif
+    debugPrint("OSC message too large for TX buffer, dropped.");
+    return true;
+  }
+  oscOutputStats.messages++;
+
+#if !OSC_BATCH_OUTPUT
+  transmitOscPacket(oscTx.data(), oscTx.size());
+  oscTx.reset();
+#endif
+  return true;
+}
+
+// Send the pending bundle. Called once per loop() tick, the bundle goes out
+// when OSC_BATCH_WINDOW_MS has passed since its first message (or every
+// tick when the window is 0) or when force is set.
+void flushOscOutput(bool force) {
+  int count = oscTx.messageCount();
+  if (count == 0) return;
+
+#if OSC_BATCH_WINDOW_MS > 0
+  if (!force && (millis() - oscBatchStartTime) < OSC_BATCH_WINDOW_MS) return;
+#else
+  (void)force;   // Every tick flushes anyway
+#endif
+
+  uint32_t start = ARM_DWT_CYCCNT;
+  if (count == 1) {
+    // A lone message goes out bare, no need for the bundle wrapper
+    size_t offset = OSC_BUNDLE_HEADER_SIZE + 4;
+    transmitOscPacket(oscTx.data() + offset, oscTx.size() - offset);
+  } else {
+    transmitOscPacket(oscTx.data(), oscTx.size());
+  }
+  metricsRecordTiming(TIMING_OSC_FLUSH, ARM_DWT_CYCCNT - start);
+
+  oscTx.reset();
+}
+
+const OscOutputStats &getOscOutputStats() {
+  return oscOutputStats;
+}
+
+//================================
+// FADER OSC RATE LIMITER
+//================================
+// Each fader has a token bucket refilled at one token per OSC_RATE_LIMIT ms.
+// A value goes out at once when a token is available (leading edge), otherwise
+// it waits in pendingOscValue, replacing any older pending value. Pending
+// values are flushed by serviceOscRateLimiter() as soon as a token refills
+// (trailing edge), so the final fader position always reaches the console.
+
+static OscLimiterStats oscLimiterStats = { 0, 0, 0 };
+
+static void refillOscTokens(Fader& f, unsigned long now) {
+  f.oscTokens += (now - f.oscTokenTime) / (float)OSC_RATE_LIMIT;
+  if (f.oscTokens > OSC_RATE_BURST) f.oscTokens = OSC_RATE_BURST;
+  f.oscTokenTime = now;
+}
+
+static void transmitFaderValue(Fader& f, int value, unsigned long now) {
+  if (faderOscAddressPage != currentOSCPage) {
+    updateFaderOscAddresses();
+  }
+
+  debugPrintf("Sending OSC update for Fader %d on Page %d → value: %d\n", f.oscID, currentOSCPage, value);
+
+  do {
+    OscWriter &w = beginOscMessage();
+    w.beginMessage(faderOscAddress[&f - faders], ",i");
+    w.addInt(value);
+  } while (!endOscMessage());
+
+  f.oscTokens = (f.oscTokens >= 1.0f) ? f.oscTokens - 1.0f : 0.0f;
+  f.lastOscSendTime = now;
+  f.lastSentOscValue = value;
+  f.pendingOscValue = -1;
+  oscLimiterStats.sent++;
+
+  if (f.touchLatencyPending) {
+    f.touchLatencyPending = false;
+    f.touchLatencyQueued = true;
   }
 }
 
@@ -116,75 +546,58 @@ void handlePageUpdate(const char *address, int value) {
 
 void sendOscUpdate(Fader& f, int value, bool force) {
   unsigned long now = millis();
+  refillOscTokens(f, now);
 
+  // Nothing new for the console, forget any older value still waiting
+  if (!force && abs(value - f.lastSentOscValue) < Fconfig.sendTolerance) {
+    if (f.pendingOscValue >= 0) {
+      f.pendingOscValue = -1;
+      oscLimiterStats.dropped++;
+    }
+    return;
+  }
 
-  // Only send if value changed significantly or enough time passed or force flag is set
-  if (force || (abs(value - f.lastSentOscValue) >= Fconfig.sendTolerance && 
-      now - f.lastOscSendTime > OSC_RATE_LIMIT)) {
-    
-    char oscAddress[32];
-    snprintf(oscAddress, sizeof(oscAddress), "/Page%d/Fader%d", currentOSCPage, f.oscID);
-    
+  // Forced sends (fader hit an end stop) skip the limiter
+  if (force || f.oscTokens >= 1.0f) {
+    transmitFaderValue(f, value, now);
+    return;
+  }
 
-    debugPrintf("Sending OSC update for Fader %d on Page %d → value: %d\n", f.oscID, currentOSCPage, value);
-    
-  
-    
-    uint8_t buffer[64];
-    int size = 0;
-    
-    // Copy address with null terminator
-    int addrLen = strlen(oscAddress);
-    memcpy(buffer + size, oscAddress, addrLen + 1);
-    size += addrLen + 1;
-    
-    // Pad to 4-byte boundary
-    while ((size & 3) != 0) buffer[size++] = 0;
-    
-    // Add type tag - for integer value
-    buffer[size++] = ',';
-    buffer[size++] = 'i'; // Integer type
-    buffer[size++] = 0;   // Null terminator
-    buffer[size++] = 0;   // Padding to 4-byte boundary
-    
-    // Add value (big-endian 32-bit integer)
-    buffer[size++] = (value >> 24) & 0xFF;
-    buffer[size++] = (value >> 16) & 0xFF;
-    buffer[size++] = (value >> 8) & 0xFF;
-    buffer[size++] = value & 0xFF;
-    
-    // Send OSC packet
-    udp.beginPacket(netConfig.sendToIP, netConfig.sendPort);
-    udp.write(buffer, size);
-    udp.endPacket();
-    
-    f.lastOscSendTime = now;
-    f.lastSentOscValue = value;
+  // Out of tokens, hold the newest value for the trailing edge
+  if (f.pendingOscValue >= 0) {
+    oscLimiterStats.coalesced++;
   }
+  f.pendingOscValue = value;
 }
 
-void handleColorOsc(const char *address, const char *colorString) {
-  // Extract the fader ID from the address
-  int faderID = 0;
-  
-  // Search for "Color" in the address string
-  const char* colorPos = strstr(address, "Color");
-  if (colorPos) {
-    // Extract fader ID after "Color"
-    faderID = atoi(colorPos + 5); // +5 to skip past "Color"
-    
-    // Find the fader with matching OSC ID
-    for (int i = 0; i < NUM_FADERS; i++) {
-      if (faders[i].oscID == faderID) {
-        parseColorValues(colorString, faders[i]);
-        debugPrintf("Color update for Fader %d: R=%d, G=%d, B=%d\n", 
-                   i, faders[i].red, faders[i].green, faders[i].blue);
-        break;
-      }
+// Send held-back values whose token has refilled, called every loop pass
+void serviceOscRateLimiter() {
+  unsigned long now = millis();
+
+  for (int i = 0; i < NUM_FADERS; i++) {
+    Fader& f = faders[i];
+    if (f.pendingOscValue < 0) continue;
+
+    refillOscTokens(f, now);
+    if (f.oscTokens >= 1.0f) {
+      transmitFaderValue(f, f.pendingOscValue, now);
     }
   }
 }
 
+const OscLimiterStats &getOscLimiterStats() {
+  return oscLimiterStats;
+}
+
+void handleColorOsc(int faderID, const char *colorString) {
+  int faderIndex = getFaderIndexFromID(faderID);
+  if (faderIndex < 0) return;
+
+  parseColorValues(colorString, faders[faderIndex]);
+  debugPrintf("Color update for Fader %d: R=%d, G=%d, B=%d\n", 
+             faderIndex, faders[faderIndex].red, faders[faderIndex].green, faders[faderIndex].blue);
+}
+
 //================================
 // OSC UTILITY FUNCTIONS
 //================================
@@ -303,47 +716,193 @@ bool isBundleStart(const uint8_t *buf, size_t len) {
 }
 
 
-// Put together and send an OSC message for Key presses and Encoder turns
+//================================
+// OSC BUNDLES
+//================================
+// Bundle layout: "#bundle\0" + 8 byte NTP timetag + elements of (int32 size, data).
+// Elements can be messages or nested bundles.
+
+// A message held until its timetag is due
+struct ScheduledOscMessage {
+  bool used;
+  uint32_t seq;                 // Arrival order, keeps same-time messages in order
+  unsigned long dueMicros;      // Local micros() when it should be dispatched
+  uint16_t size;
+  uint8_t data[OSC_SCHED_MSG_MAX];
+};
+
+static ScheduledOscMessage oscSchedule[OSC_SCHED_SLOTS];
+static uint32_t oscScheduleSeq = 0;
+
+// Sender clock offset, learned as the smallest (timetag - local time) seen.
+// There is no clock sync with the console, so the earliest stamped bundle is
+// treated as "due now" and later timetags keep their spacing relative to it.
+static bool oscClockValid = false;
+static int64_t oscClockOffsetUs = 0;
+static int64_t oscClockWindowMinUs = 0;
+static unsigned long oscClockWindowStart = 0;
+
+static uint32_t readBE32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
 
-void sendOscMessage(const char* address, const char* typeTag, const void* value) {
-  uint8_t buffer[128];
-  int len = 0;
-
-  // Write address
-  int addrLen = strlen(address);
-  memcpy(buffer + len, address, addrLen);
-  len += addrLen;
-  buffer[len++] = '\0';
-  while (len % 4 != 0) buffer[len++] = '\0';
-
-  // Write type tag
-  int tagLen = strlen(typeTag);
-  memcpy(buffer + len, typeTag, tagLen);
-  len += tagLen;
-  buffer[len++] = '\0';
-  while (len % 4 != 0) buffer[len++] = '\0';
-
-  // Add argument(s)
-  if (strcmp(typeTag, ",i") == 0) {
-    int v = *(int*)value;
-    uint32_t netOrder = htonl(v);
-    memcpy(buffer + len, &netOrder, 4);
-    len += 4;
-  } else if (strcmp(typeTag, ",s") == 0) {
-    const char* str = (const char*)value;
-    int strLen = strlen(str);
-    memcpy(buffer + len, str, strLen);
-    len += strLen;
-    buffer[len++] = '\0';
-    while (len % 4 != 0) buffer[len++] = '\0';
+// micros() extended to 64 bits so clock math survives the 71 minute wrap
+static uint64_t micros64() {
+  static uint32_t lastMicros = 0;
+  static uint32_t wraps = 0;
+  uint32_t now = micros();
+  if (now < lastMicros) wraps++;
+  lastMicros = now;
+  return ((uint64_t)wraps << 32) | now;
+}
+
+// NTP timetag (seconds since 1900 . 32 bit fraction) to microseconds
+static int64_t timetagToMicros(uint64_t timetag) {
+  uint64_t seconds = timetag >> 32;
+  uint64_t fraction = timetag & 0xFFFFFFFFULL;
+  return (int64_t)(seconds * 1000000ULL + ((fraction * 1000000ULL) >> 32));
+}
+
+void handleOscBundle(const uint8_t *data, int size, int depth) {
+  if (depth >= OSC_BUNDLE_MAX_DEPTH) {
+    debugPrint("OSC bundle nested too deep, dropped.");
+    netMetrics.bundleErrors++;
+    return;
+  }
+
+  uint64_t timetag = ((uint64_t)readBE32(data + 8) << 32) | readBE32(data + 12);
+  int pos = 16;
+
+  while (pos + 4 <= size) {
+    int32_t elementSize = (int32_t)readBE32(data + pos);
+    pos += 4;
+
+    if (elementSize <= 0 || (elementSize & 3) != 0 || elementSize > size - pos) {
+      debugPrint("Invalid OSC bundle element.");
+      netMetrics.bundleErrors++;
+      return;
+    }
+
+    const uint8_t *element = data + pos;
+    if (isBundleStart(element, elementSize)) {
+      handleOscBundle(element, elementSize, depth + 1);
+    } else {
+      scheduleOscMessage(timetag, element, elementSize);
+    }
+    pos += elementSize;
+  }
+}
+
+void scheduleOscMessage(uint64_t timetag, const uint8_t *data, int size) {
+  if (timetag == OSC_TIMETAG_IMMEDIATE) {
+    dispatchOscPacket(data, size);
+    return;
+  }
+
+  // Learn the sender clock offset, re-anchoring once per window so drift is followed
+  unsigned long nowMs = millis();
+  uint64_t nowUs = micros64();
+  int64_t offset = timetagToMicros(timetag) - (int64_t)nowUs;
+
+  if (!oscClockValid) {
+    oscClockValid = true;
+    oscClockOffsetUs = offset;
+    oscClockWindowMinUs = offset;
+    oscClockWindowStart = nowMs;
   } else {
+    if (offset < oscClockWindowMinUs) oscClockWindowMinUs = offset;
+    if (offset < oscClockOffsetUs) oscClockOffsetUs = offset;
+    if (nowMs - oscClockWindowStart > OSC_CLOCK_WINDOW_MS) {
+      oscClockOffsetUs = oscClockWindowMinUs;
+      oscClockWindowMinUs = offset;
+      oscClockWindowStart = nowMs;
+    }
+  }
+
+  int64_t delayUs = offset - oscClockOffsetUs;
+  if (delayUs <= 0) {
+    dispatchOscPacket(data, size);
+    return;
+  }
+  if (delayUs > (int64_t)OSC_SCHED_MAX_DELAY_MS * 1000) {
+    debugPrint("OSC timetag too far ahead, applying now.");
+    dispatchOscPacket(data, size);
+    return;
+  }
+
+  if (size > OSC_SCHED_MSG_MAX) {
+    debugPrint("Timetagged OSC message too large to hold, applying now.");
+    dispatchOscPacket(data, size);
+    return;
+  }
+
+  for (int i = 0; i < OSC_SCHED_SLOTS; i++) {
+    ScheduledOscMessage &slot = oscSchedule[i];
+    if (slot.used) continue;
+
+    slot.used = true;
+    slot.seq = oscScheduleSeq++;
+    slot.dueMicros = (unsigned long)nowUs + (unsigned long)delayUs;
+    slot.size = size;
+    memcpy(slot.data, data, size);
+    return;
+  }
+
+  debugPrint("OSC schedule full, applying now.");
+  dispatchOscPacket(data, size);
+}
+
+// Dispatch every held message whose time has come, oldest first. Messages
+// sharing a timetag are released in the same pass so their setpoints are
+// applied together by applyPendingSetpoints().
+void serviceOscSchedule() {
+  while (true) {
+    unsigned long now = micros();
+    int next = -1;
+
+    for (int i = 0; i < OSC_SCHED_SLOTS; i++) {
+      ScheduledOscMessage &slot = oscSchedule[i];
+      if (!slot.used || (long)(now - slot.dueMicros) < 0) continue;
+      if (next < 0 || (long)(slot.dueMicros - oscSchedule[next].dueMicros) < 0 ||
+          (slot.dueMicros == oscSchedule[next].dueMicros && slot.seq < oscSchedule[next].seq)) {
+        next = i;
+      }
+    }
+
+    if (next < 0) return;
+
+    oscSchedule[next].used = false;
+    oscPacketRxMicros = micros();   // Latency counts from release, not arrival
+    dispatchOscPacket(oscSchedule[next].data, oscSchedule[next].size);
+  }
+}
+
+
+// Put together and send a single argument OSC message
+// Kept for callers without a precomputed address, prefer OscWriter directly
+
+void sendOscMessage(const char* address, const char* typeTag, const void* value) {
+  if (typeTag[1] != 'i' && typeTag[1] != 'f' && typeTag[1] != 's') {
     debugPrint("Unsupported OSC typeTag.");
     return;
   }
 
-  udp.beginPacket(netConfig.sendToIP, netConfig.sendPort);
-  udp.write(buffer, len);
-  udp.endPacket();
+  do {
+    OscWriter &w = beginOscMessage();
+    w.beginMessage(address, typeTag);
+
+    switch (typeTag[1]) {
+      case 'i':
+        w.addInt(*(const int*)value);
+        break;
+      case 'f':
+        w.addFloat(*(const float*)value);
+        break;
+      default:
+        w.addString((const char*)value);
+        break;
+    }
+  } while (!endOscMessage());
 }
 
 
@@ -372,12 +931,9 @@ void handleBundledFaderUpdate(LiteOSCParser& parser) {
   // Update current page if it changed
   if (pageNum != currentOSCPage) {
     debugPrintf("Page changed from %d to %d (via bundled message)\n", currentOSCPage, pageNum);
-    currentOSCPage = pageNum;
+    setCurrentOscPage(pageNum);
   }
   
-  // Track if any setpoints need updating
-  bool needToMoveFaders = false;
-  
   // Parse fader values (arguments 1-10 for faders 201-210)
   for (int i = 0; i < 10; i++) {
     int argIndex = i + 1; // Arguments 1-10
@@ -394,29 +950,13 @@ void handleBundledFaderUpdate(LiteOSCParser& parser) {
     if (faderIndex >= 0 && faderIndex < NUM_FADERS) {
       // Only update if fader is not currently being touched (avoid feedback)
       if (!faders[faderIndex].touched) {
-        
-        // Check if the value actually changed before updating
-        int currentOscvalue = readFadertoOSC(faders[faderIndex]);
-        
-        // Convert OSC value (0-100) to fader range if needed
-
-        if (abs(oscValue - currentOscvalue) > Fconfig.targetTolerance) {
-          debugPrintf("Updating fader %d setpoint: %d -> %d\n", faderOscID, currentOscvalue, oscValue);
-          setFaderSetpoint(faderIndex, oscValue);
-          needToMoveFaders = true;
-        }
+        queueFaderSetpoint(faderIndex, oscValue);
       }
     } else {
       debugPrintf("Fader index not found for OSC ID %d\n", faderOscID);
     }
   }
   
-  // Move all faders to their new setpoints if any changed
-  if (needToMoveFaders) {
-    debugPrint("Moving faders to new setpoints");
-    moveAllFadersToSetpoints();
-  }
-  
   // Parse color values (arguments 11-20 for faders 201-210)
   for (int i = 0; i < 10; i++) {
     int argIndex = i + 11; // Arguments 11-20
@@ -439,47 +979,316 @@ void handleBundledFaderUpdate(LiteOSCParser& parser) {
     }
   }
   
+  // Authoritative state for this page, it can now be cached when we leave
+  pageCacheMarkSynced();
+
   debugPrint("Bundled fader update complete");
 }
 
-// Handle osc messages comming in
+// Last value and packed color the console sent for each of faders 201-210,
+// kept even while a fader is touched. Hashed for the /faderSync ack.
+static int consoleFaderValue[10] = { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 };
+static int32_t consoleFaderColor[10] = { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 };
 
-void handleOscMessage() {
-  int size = udp.parsePacket();
-  if (size <= 0) return;
+// Packed RGB from the compact update: 0xRRGGBB
+static void applyPackedColor(Fader& f, int32_t packed) {
+  f.red = (packed >> 16) & 0xFF;
+  f.green = (packed >> 8) & 0xFF;
+  f.blue = packed & 0xFF;
+  f.colorUpdated = true;
+}
+
+// Handle compact fader updates that only carry the faders that changed
+void handleFaderDelta(LiteOSCParser& parser) {
+  // Expected format: /faderDelta,ii[ii...],PAGE,MASK,VALUE,RGB,VALUE,RGB...
+  // Bit n of MASK is fader 201+n, each set bit is followed by its value
+  // (0-100) and packed color, in ascending fader order. The console already
+  // picks primary or secondary color so no strings to parse here.
+
+  if (parser.getArgCount() < 2 || parser.getTag(0) != 'i' || parser.getTag(1) != 'i') {
+    debugPrint("Invalid fader delta message - missing page or mask");
+    return;
+  }
+
+  int pageNum = parser.getInt(0);
+  uint32_t mask = (uint32_t)parser.getInt(1) & OSC_DELTA_FULL_MASK;
+
+  int expectedArgs = 2;
+  for (int i = 0; i < 10; i++) {
+    if (mask & (1UL << i)) expectedArgs += 2;
+  }
+  if (parser.getArgCount() < expectedArgs) {
+    debugPrint("Invalid fader delta message - not enough arguments for mask");
+    return;
+  }
+
+  if (pageNum != currentOSCPage) {
+    debugPrintf("Page changed from %d to %d (via delta message)\n", currentOSCPage, pageNum);
+    setCurrentOscPage(pageNum);
+  }
+
+  int argIndex = 2;
+  for (int i = 0; i < 10; i++) {
+    if (!(mask & (1UL << i))) continue;
+
+    int valueArg = argIndex;
+    int colorArg = argIndex + 1;
+    argIndex += 2;
+
+    if (parser.getTag(valueArg) == 'i') consoleFaderValue[i] = parser.getInt(valueArg);
+    if (parser.getTag(colorArg) == 'i') consoleFaderColor[i] = parser.getInt(colorArg);
+
+    int faderIndex = getFaderIndexFromID(201 + i);
+    if (faderIndex < 0 || faderIndex >= NUM_FADERS) continue;
+    if (faders[faderIndex].touched) continue;   // Avoid feedback while touched
+
+    if (parser.getTag(valueArg) == 'i') {
+      queueFaderSetpoint(faderIndex, parser.getInt(valueArg));
+    }
+    if (parser.getTag(colorArg) == 'i') {
+      applyPackedColor(faders[faderIndex], parser.getInt(colorArg));
+    }
+  }
+
+  // A full mask carries the whole page, same as /faderUpdate
+  if (mask == OSC_DELTA_FULL_MASK) {
+    pageCacheMarkSynced();
+  }
+}
+
+// FNV-1a over the page and each fader's value and color, 4 bytes each little
+// endian. The Lua script computes the same hash over what it last sent.
+static uint32_t getFaderStateHash(int page) {
+  uint32_t hash = 2166136261UL;
+  int32_t words[1 + 20];
+  words[0] = page;
+  for (int i = 0; i < 10; i++) {
+    words[1 + i * 2] = consoleFaderValue[i];
+    words[2 + i * 2] = consoleFaderColor[i];
+  }
+  for (int w = 0; w < 21; w++) {
+    uint32_t word = (uint32_t)words[w];
+    for (int b = 0; b < 4; b++) {
+      hash ^= (word >> (b * 8)) & 0xFF;
+      hash *= 16777619UL;
+    }
+  }
+  return hash;
+}
+
+// Handle /faderSync,ii,PAGE,HASH from the console. We answer the console
+// with our own page and hash by setting a global variable through /cmd, the
+// script compares it with what it sent and only resends everything when
+// they differ.
+void handleFaderSync(LiteOSCParser& parser) {
+  if (parser.getArgCount() < 2 || parser.getTag(0) != 'i' || parser.getTag(1) != 'i') {
+    debugPrint("Invalid fader sync message");
+    return;
+  }
+
+  uint32_t consoleHash = (uint32_t)parser.getInt(1);
+  uint32_t localHash = getFaderStateHash(currentOSCPage);
+
+  char command[64];
+  snprintf(command, sizeof(command), "SetGlobalVariable \"EvoWingAck\" \"%d:%lu\"",
+           currentOSCPage, (unsigned long)localHash);
+
+  // Straight to the console only, the extra OSC destinations (visualizers,
+  // backups) must not receive console commands
+  uint8_t buffer[16 + sizeof(command)];
+  OscWriter ack(buffer, sizeof(buffer));
+  ack.beginMessage("/cmd", ",s");
+  ack.addString(command);
+  if (ack.endMessage()) {
+    sendToDestination(0, netConfig.sendToIP, netConfig.sendPort, netConfig.sendTcp, ack.data(), ack.size());
+    oscOutputStats.messages++;
+    oscOutputStats.packets++;
+  }
+
+  if (localHash != consoleHash) {
+    debugPrintf("[OSC] Fader state hash mismatch on page %d (console %lu, wing %lu)\n",
+                currentOSCPage, (unsigned long)consoleHash, (unsigned long)localHash);
+  }
+}
+
+//================================
+// OSC ROUTES
+//================================
+// Adapters between the address router and the handlers above.
+// Captures come from the '#' fields of each pattern, routes without any
+// leave the match unnamed.
+
+static void routeFaderUpdate(LiteOSCParser &parser, const OscRouteMatch &) {
+  uint32_t start = ARM_DWT_CYCCNT;
+  handleBundledFaderUpdate(parser);
+  metricsRecordTiming(TIMING_FADER_UPDATE, ARM_DWT_CYCCNT - start);
+}
+
+static void routeFaderDelta(LiteOSCParser &parser, const OscRouteMatch &) {
+  uint32_t start = ARM_DWT_CYCCNT;
+  handleFaderDelta(parser);
+  metricsRecordTiming(TIMING_FADER_DELTA, ARM_DWT_CYCCNT - start);
+}
+
+static void routeFaderSync(LiteOSCParser &parser, const OscRouteMatch &) {
+  handleFaderSync(parser);
+}
+
+static void routePageUpdate(LiteOSCParser &parser, const OscRouteMatch &) {
+  if (parser.getArgCount() > 0 && parser.getTag(0) == 'i') {
+    handlePageUpdate(parser.getInt(0));
+  }
+}
+
+static void routeColor(LiteOSCParser &parser, const OscRouteMatch &match) {
+  if (parser.getArgCount() > 0 && parser.getTag(0) == 's') {
+    handleColorOsc(match.captures[0], parser.getString(0));
+  }
+}
+
+static void routeFaderMovement(LiteOSCParser &parser, const OscRouteMatch &match) {
+  if (parser.getArgCount() > 0 && parser.getTag(0) == 'i') {
+    handleOscMovement(match.captures[0], match.captures[1], parser.getInt(0));
+  }
+}
+
+// The old strstr() dispatch took /faderUpdate and /updatePage/current
+// anywhere in the address, so senders that put a page or layout prefix in
+// front still reach them through the "/*/" forms (one prefix segment only)
+void setupOscRoutes() {
+  oscRouterClear();
+  oscRouterAdd("/faderUpdate", routeFaderUpdate);
+  oscRouterAdd("/*/faderUpdate", routeFaderUpdate);
+  oscRouterAdd("/faderDelta", routeFaderDelta);
+  oscRouterAdd("/faderSync", routeFaderSync);
+  oscRouterAdd("/updatePage/current", routePageUpdate);
+  oscRouterAdd("/*/updatePage/current", routePageUpdate);
+  oscRouterAdd("/Page#/Fader#", routeFaderMovement);
+  oscRouterAdd("/Color#", routeColor);
+  oscRouterAdd("/*/Color#", routeColor);
+
+  buildFaderIdLookup();
+  updateFaderOscAddresses();
+}
+
+// Handle a single OSC datagram
+void dispatchOscPacket(const uint8_t *data, int size) {
+  if (isBundleStart(data, size)) {
+    handleOscBundle(data, size);
+    return;
+  }
 
-  const uint8_t *data = udp.data();
   LiteOSCParser parser;
 
   if (!parser.parse(data, size)) {
     debugPrint("Invalid OSC message.");
+    netMetrics.parseErrors++;
     return;
   }
 
-  const char* addr = parser.getAddress();
+  if (!oscRouterDispatch(parser)) {
+    debugPrintf("[OSC] No route for %s\n", parser.getAddress());
+    netMetrics.unknownAddress++;
+  }
+}
 
-  // Handle bundled fader update messages (NEW)
-  if (strstr(addr, "/faderUpdate") != NULL) {
-    handleBundledFaderUpdate(parser);
+//================================
+// LATENCY PROBE
+//================================
+// /ping is answered straight back to the sender as /pong before any other
+// processing. The ping's int and float args are echoed (a sequence number
+// or host timestamp), followed by two ints: micros() when the packet was
+// read and micros() just before the pong was sent.
+
+#define OSC_PING_MAX_ARGS 8
+
+static bool handleOscPing(const uint8_t *data, int size, unsigned long rxMicros) {
+  if (size < 8 || memcmp(data, "/ping\0\0\0", 8) != 0) return false;
+
+  // Type tags follow the 8 byte padded address
+  int pos = 8;
+  const char *tags = "";
+  if (pos < size && data[pos] == ',') {
+    tags = (const char *)data + pos;
+    int tagLength = strnlen(tags, size - pos);
+    if (pos + tagLength >= size) return true;   // Unterminated, drop it
+    pos += (tagLength + 4) & ~3;
+    tags++;
   }
-  // Handle page update messages (EXISTING)
-  else if (strstr(addr, "/updatePage/current") != NULL) {
-    if (parser.getTag(0) == 'i') {
-      handlePageUpdate(addr, parser.getInt(0));
-    }
+
+  char pongTags[OSC_PING_MAX_ARGS + 4] = ",";
+  int32_t echoed[OSC_PING_MAX_ARGS];
+  int echoCount = 0;
+
+  for (; *tags && echoCount < OSC_PING_MAX_ARGS; tags++) {
+    if ((*tags != 'i' && *tags != 'f') || pos + 4 > size) break;
+    pongTags[1 + echoCount] = *tags;
+    echoed[echoCount++] = (int32_t)readBE32(data + pos);
+    pos += 4;
   }
-  // Handle color messages (EXISTING)
-  else if (strstr(addr, "/Color") != NULL) {
-    if (parser.getTag(0) == 's') {
-      handleColorOsc(addr, parser.getString(0));
-    }
+  strcpy(pongTags + 1 + echoCount, "ii");
+
+  uint8_t buffer[64 + OSC_PING_MAX_ARGS * 4];
+  OscWriter pong(buffer, sizeof(buffer));
+  pong.beginMessage("/pong", pongTags);
+  for (int i = 0; i < echoCount; i++) {
+    pong.addInt(echoed[i]);   // Raw bits, so floats round trip unchanged
   }
-  // Handle individual fader movement messages (EXISTING)
-  else if (strstr(addr, "/Page") != NULL && strstr(addr, "/Fader") != NULL) {
-    if (parser.getTag(0) == 'i') {
-      int value = parser.getInt(0);
-      handleOscMovement(addr, value);
-    }
+  pong.addInt((int32_t)rxMicros);
+  pong.addInt((int32_t)micros());
+  pong.endMessage();
+
+  udp.beginPacket(udp.remoteIP(), udp.remotePort());
+  udp.write(pong.data(), pong.size());
+  udp.endPacket();
+  netMetrics.pings++;
+  netMetrics.packetsOut++;
+  netMetrics.bytesOut += pong.size();
+  return true;
+}
+
+// Handle osc messages coming in
+// Drains every pending datagram (bounded by OSC_RX_MAX_PACKETS / OSC_RX_BUDGET_US)
+// so a burst from the console is not spread over several loop() passes
+void handleOscMessage() {
+  unsigned long startTime = micros();
+  uint32_t startCycles = ARM_DWT_CYCCNT;
+  int packets = 0;
+
+  while (packets < OSC_RX_MAX_PACKETS && (micros() - startTime) < OSC_RX_BUDGET_US) {
+    int size = udp.parsePacket();
+    if (size <= 0) break;
+
+    oscPacketRxMicros = micros();
+    packets++;
+    netMetrics.packetsIn++;
+    netMetrics.bytesIn += size;
+
+    // Latency probe first so its answer does not wait on fader handling
+    if (handleOscPing(udp.data(), size, oscPacketRxMicros)) continue;
+
+    PROFILE_ZONE("osc_dispatch");
+    uint32_t dispatchStart = ARM_DWT_CYCCNT;
+    dispatchOscPacket(udp.data(), size);
+    metricsRecordTiming(TIMING_OSC_DISPATCH, ARM_DWT_CYCCNT - dispatchStart);
+  }
+
+  if (packets > 1) {
+    debugPrintf("[OSC] Drained %d packets in %lu us\n", packets, micros() - startTime);
+  }
+
+  // OSC over TCP feeds the same dispatcher
+  serviceOscTcp();
+
+  // Release any timetagged messages that are now due
+  serviceOscSchedule();
+
+  // Newest value per fader wins, motors are driven once for the whole batch
+  applyPendingSetpoints();
+
+  // Idle passes would only bury the real numbers
+  if (packets > 0) {
+    metricsRecordTiming(TIMING_OSC_RECEIVE, ARM_DWT_CYCCNT - startCycles);
   }
 }
 
@@ -490,9 +1299,24 @@ void handleOscMessage() {
 void printOSC(Print &out, const uint8_t *b, int len) {
   LiteOSCParser osc;
 
-  // Check if it's a bundle
+  // Print bundles element by element
   if (isBundleStart(b, len)) {
-    out.println("#bundle (not parsed)");
+    uint64_t timetag = ((uint64_t)readBE32(b + 8) << 32) | readBE32(b + 12);
+    out.printf("#bundle timetag=%08lX.%08lX\n",
+               (unsigned long)(timetag >> 32), (unsigned long)(timetag & 0xFFFFFFFFUL));
+
+    int pos = 16;
+    while (pos + 4 <= len) {
+      int32_t elementSize = (int32_t)readBE32(b + pos);
+      pos += 4;
+      if (elementSize <= 0 || elementSize > len - pos) {
+        out.println("#ParseError");
+        return;
+      }
+      out.print("  ");
+      printOSC(out, b + pos, elementSize);
+      pos += elementSize;
+    }
     return;
   }
 
@@ -7,6 +7,7 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <IPAddress.h>
+#include "FixedString.h"
 
 // === Constructor and Destructor ===
 
@@ -435,32 +436,34 @@ void OLED::showIPAddress(IPAddress ip, uint16_t recvPort, IPAddress sendIP, uint
 }
 
 // === Debug Line Buffer ===
+// Ring of fixed lines, the oldest is overwritten, nothing is shifted or allocated
 #define MAX_DEBUG_LINES 5
-static String debugLines[MAX_DEBUG_LINES];
+#define DEBUG_LINE_CHARS 22     // 21 fit across at size 1
+static FixedString<DEBUG_LINE_CHARS> debugLines[MAX_DEBUG_LINES];
+static int debugLineNext = 0;   // Slot the next line goes in, also the oldest
 static unsigned long lastDebugDraw = 0;
 static const unsigned long debugDrawInterval = 200;  // ms
 
 void OLED::addDebugLine(const char* text) {
     if (!displayInitialized || !oledDisplay || !text) return;
 
-    // Shift lines up
-    for (int i = 0; i < MAX_DEBUG_LINES - 1; i++) {
-        debugLines[i] = debugLines[i + 1];
-    }
-    debugLines[MAX_DEBUG_LINES - 1] = String(text);
+    FixedString<DEBUG_LINE_CHARS> &line = debugLines[debugLineNext];
+    line.clear();
+    line.print(text);
+    debugLineNext = (debugLineNext + 1) % MAX_DEBUG_LINES;
 
     // Throttle refresh rate
     unsigned long now = millis();
     if (now - lastDebugDraw < debugDrawInterval) return;
     lastDebugDraw = now;
 
-    // Draw bottom lines
+    // Draw bottom lines, oldest first
     for (int i = 0; i < MAX_DEBUG_LINES; i++) {
         clearLine(3 + i);
         setCursor(0, (3 + i) * CHAR_HEIGHT_SMALL);
         setTextSize(TEXT_SIZE_SMALL);
         setTextColor(SSD1306_WHITE);
-        oledDisplay->print(debugLines[i]);
+        oledDisplay->print(debugLines[(debugLineNext + i) % MAX_DEBUG_LINES].c_str());
     }
     oledDisplay->display();
 }
\ No newline at end of file
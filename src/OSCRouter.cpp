@@ -0,0 +1,195 @@
+// OSCRouter.cpp
+
+#include "OSCRouter.h"
+#include "Utils.h"
+#include <limits.h>
+
+//================================
+// ROUTE TRIE
+//================================
+// Node 0 is the root. Every other node holds one address segment pattern;
+// children of a node are the possible next segments.
+
+struct OscRouteNode {
+  char segment[OSC_ROUTER_MAX_SEGMENT];
+  uint8_t length;           // strlen(segment)
+  bool literal;             // No wildcards, matched with memcmp
+  int8_t firstChild;
+  int8_t nextSibling;
+  OscRouteHandler handler;  // Set when a pattern ends at this node
+};
+
+static OscRouteNode routeNodes[OSC_ROUTER_MAX_NODES];
+static int routeNodeCount = 0;
+
+void oscRouterClear() {
+  routeNodeCount = 1;
+  routeNodes[0].segment[0] = '\0';
+  routeNodes[0].length = 0;
+  routeNodes[0].literal = true;
+  routeNodes[0].firstChild = -1;
+  routeNodes[0].nextSibling = -1;
+  routeNodes[0].handler = nullptr;
+}
+
+// Find or create the child of parent holding this segment pattern
+static int findOrAddChild(int parent, const char *segment, int length) {
+  for (int i = routeNodes[parent].firstChild; i >= 0; i = routeNodes[i].nextSibling) {
+    if (routeNodes[i].length == length && memcmp(routeNodes[i].segment, segment, length) == 0) {
+      return i;
+    }
+  }
+
+  if (routeNodeCount >= OSC_ROUTER_MAX_NODES || length >= OSC_ROUTER_MAX_SEGMENT) {
+    return -1;
+  }
+
+  int index = routeNodeCount++;
+  OscRouteNode &node = routeNodes[index];
+  memcpy(node.segment, segment, length);
+  node.segment[length] = '\0';
+  node.length = length;
+  node.literal = strpbrk(node.segment, "#?*") == NULL;
+  node.firstChild = -1;
+  node.nextSibling = -1;
+  node.handler = nullptr;
+
+  // Literal segments go to the front so exact matches win over wildcards
+  if (node.literal || routeNodes[parent].firstChild < 0) {
+    node.nextSibling = routeNodes[parent].firstChild;
+    routeNodes[parent].firstChild = index;
+  } else {
+    int last = routeNodes[parent].firstChild;
+    while (routeNodes[last].nextSibling >= 0) last = routeNodes[last].nextSibling;
+    routeNodes[last].nextSibling = index;
+  }
+  return index;
+}
+
+bool oscRouterAdd(const char *pattern, OscRouteHandler handler) {
+  if (routeNodeCount == 0) oscRouterClear();
+
+  if (pattern == NULL || pattern[0] != '/') {
+    debugPrintf("[OSC] Route must start with '/': %s", pattern ? pattern : "NULL");
+    return false;
+  }
+
+  int node = 0;
+  const char *segment = pattern + 1;
+
+  while (true) {
+    const char *end = strchr(segment, '/');
+    int length = end ? (int)(end - segment) : (int)strlen(segment);
+
+    node = findOrAddChild(node, segment, length);
+    if (node < 0) {
+      debugPrintf("[OSC] Route table full, dropped %s", pattern);
+      return false;
+    }
+
+    if (!end) break;
+    segment = end + 1;
+  }
+
+  routeNodes[node].handler = handler;
+  return true;
+}
+
+//================================
+// MATCHING
+//================================
+
+// Match one address segment against one pattern segment, collecting captures
+static bool matchSegment(const char *pattern, const char *segment, const char *segmentEnd,
+                         OscRouteMatch &match) {
+  while (*pattern) {
+    switch (*pattern) {
+      case '#': {
+        if (segment >= segmentEnd || *segment < '0' || *segment > '9') return false;
+        if (match.count >= OSC_ROUTER_MAX_CAPTURES) return false;
+
+        // A digit run too long for an int fails the match instead of wrapping
+        int value = 0;
+        while (segment < segmentEnd && *segment >= '0' && *segment <= '9') {
+          int digit = *segment - '0';
+          if (value > (INT_MAX - digit) / 10) return false;
+          value = value * 10 + digit;
+          segment++;
+        }
+        match.captures[match.count++] = value;
+        pattern++;
+        break;
+      }
+
+      case '?':
+        if (segment >= segmentEnd) return false;
+        segment++;
+        pattern++;
+        break;
+
+      case '*': {
+        pattern++;
+        if (*pattern == '\0') return true;
+
+        // Try every split point, restoring captures between attempts
+        uint8_t savedCount = match.count;
+        for (const char *s = segment; s <= segmentEnd; s++) {
+          if (matchSegment(pattern, s, segmentEnd, match)) return true;
+          match.count = savedCount;
+        }
+        return false;
+      }
+
+      default:
+        if (segment >= segmentEnd || *segment != *pattern) return false;
+        segment++;
+        pattern++;
+        break;
+    }
+  }
+
+  return segment == segmentEnd;
+}
+
+// Depth-first walk of the trie, backtracking when a wildcard branch dead-ends
+static OscRouteHandler walkRoutes(int node, const char *address, OscRouteMatch &match) {
+  if (*address == '\0') return routeNodes[node].handler;
+  if (*address != '/') return nullptr;
+
+  const char *segment = address + 1;
+  const char *segmentEnd = strchr(segment, '/');
+  if (!segmentEnd) segmentEnd = segment + strlen(segment);
+  int length = segmentEnd - segment;
+
+  for (int i = routeNodes[node].firstChild; i >= 0; i = routeNodes[i].nextSibling) {
+    const OscRouteNode &child = routeNodes[i];
+    uint8_t savedCount = match.count;
+
+    bool matched = child.literal
+      ? (child.length == length && memcmp(child.segment, segment, length) == 0)
+      : matchSegment(child.segment, segment, segmentEnd, match);
+
+    if (matched) {
+      OscRouteHandler handler = walkRoutes(i, segmentEnd, match);
+      if (handler) return handler;
+    }
+    match.count = savedCount;
+  }
+
+  return nullptr;
+}
+
+OscRouteHandler oscRouterLookup(const char *address, OscRouteMatch &match) {
+  match.count = 0;
+  if (routeNodeCount == 0 || address == NULL) return nullptr;
+  return walkRoutes(0, address, match);
+}
+
+bool oscRouterDispatch(LiteOSCParser &parser) {
+  OscRouteMatch match;
+  OscRouteHandler handler = oscRouterLookup(parser.getAddress(), match);
+  if (!handler) return false;
+
+  handler(parser, match);
+  return true;
+}
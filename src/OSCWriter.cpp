@@ -0,0 +1,158 @@
+// OSCWriter.cpp
+
+#include "OSCWriter.h"
+#include <stdarg.h>
+
+//================================
+// ADDRESS TEMPLATE
+//================================
+
+bool oscAddressFormat(OscAddress &address, const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(address.data, sizeof(address.data), format, args);
+  va_end(args);
+
+  // Need room for the terminator and padding
+  size_t padded = (n + 4) & ~3;
+  if (n < 0 || padded > sizeof(address.data)) {
+    address.length = 0;
+    return false;
+  }
+
+  memset(address.data + n, 0, padded - n);
+  address.length = padded;
+  return true;
+}
+
+//================================
+// MESSAGE WRITER
+//================================
+
+OscWriter::OscWriter(uint8_t *buffer, size_t capacity)
+  : buf(buffer), cap(capacity), len(0), overflow(false),
+    inBundle(false), messageStart(0), messages(0) {
+}
+
+void OscWriter::reset() {
+  len = 0;
+  overflow = false;
+  inBundle = false;
+  messageStart = 0;
+  messages = 0;
+}
+
+bool OscWriter::beginBundle(uint64_t timetag) {
+  reset();
+  if (!reserve(OSC_BUNDLE_HEADER_SIZE)) return false;
+
+  writePadded("#bundle", 7);
+  writeBE32((uint32_t)(timetag >> 32));
+  writeBE32((uint32_t)timetag);
+  inBundle = true;
+  return true;
+}
+
+bool OscWriter::startElement(size_t headerBytes) {
+  messageStart = len;
+  size_t sizeField = inBundle ? 4 : 0;
+  if (!reserve(sizeField + headerBytes)) return false;
+
+  // Placeholder for the element size, patched in endMessage()
+  if (inBundle) writeBE32(0);
+  return true;
+}
+
+bool OscWriter::reserve(size_t bytes) {
+  if (overflow || len + bytes > cap) {
+    overflow = true;
+    return false;
+  }
+  return true;
+}
+
+void OscWriter::writeBE32(uint32_t value) {
+  buf[len++] = (value >> 24) & 0xFF;
+  buf[len++] = (value >> 16) & 0xFF;
+  buf[len++] = (value >> 8) & 0xFF;
+  buf[len++] = value & 0xFF;
+}
+
+void OscWriter::writePadded(const void *data, size_t length) {
+  size_t padded = (length + 4) & ~3;
+  memcpy(buf + len, data, length);
+  memset(buf + len + length, 0, padded - length);
+  len += padded;
+}
+
+bool OscWriter::beginMessage(const OscAddress &address, const char *typeTags) {
+  size_t tagLength = strlen(typeTags);
+  if (address.length == 0 || !startElement(address.length + ((tagLength + 4) & ~3))) return false;
+
+  memcpy(buf + len, address.data, address.length);
+  len += address.length;
+  writePadded(typeTags, tagLength);
+  return true;
+}
+
+bool OscWriter::beginMessage(const char *address, const char *typeTags) {
+  size_t addressLength = strlen(address);
+  size_t tagLength = strlen(typeTags);
+  if (!startElement(((addressLength + 4) & ~3) + ((tagLength + 4) & ~3))) return false;
+
+  writePadded(address, addressLength);
+  writePadded(typeTags, tagLength);
+  return true;
+}
+
+bool OscWriter::addInt(int32_t value) {
+  if (!reserve(4)) return false;
+  writeBE32((uint32_t)value);
+  return true;
+}
+
+bool OscWriter::addFloat(float value) {
+  if (!reserve(4)) return false;
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  writeBE32(bits);
+  return true;
+}
+
+bool OscWriter::addString(const char *value) {
+  size_t length = strlen(value);
+  if (!reserve((length + 4) & ~3)) return false;
+  writePadded(value, length);
+  return true;
+}
+
+bool OscWriter::addBlob(const uint8_t *data, size_t length) {
+  size_t padded = (length + 3) & ~3;
+  if (!reserve(4 + padded)) return false;
+
+  writeBE32(length);
+  memcpy(buf + len, data, length);
+  memset(buf + len + length, 0, padded - length);
+  len += padded;
+  return true;
+}
+
+bool OscWriter::endMessage() {
+  if (overflow) return false;
+
+  if (inBundle) {
+    uint32_t elementSize = len - messageStart - 4;
+    buf[messageStart]     = (elementSize >> 24) & 0xFF;
+    buf[messageStart + 1] = (elementSize >> 16) & 0xFF;
+    buf[messageStart + 2] = (elementSize >> 8) & 0xFF;
+    buf[messageStart + 3] = elementSize & 0xFF;
+  }
+  messages++;
+  messageStart = len;
+  return true;
+}
+
+void OscWriter::rollbackMessage() {
+  len = messageStart;
+  overflow = false;
+}
@@ -0,0 +1,96 @@
+// PageCache.cpp
+
+#include "PageCache.h"
+#include "NetworkOSC.h"
+#include "Utils.h"
+
+//================================
+// CACHE STORAGE
+//================================
+// Last known state of recently visited pages. On a page change the faders
+// start moving from here straight away, the console's /faderUpdate for the
+// new page then corrects anything that changed while we were away.
+
+struct PageCacheEntry {
+  int page;                      // 0 = unused slot
+  unsigned long lastUsed;        // For least recently used replacement
+  uint8_t value[NUM_FADERS];     // Setpoints in OSC units (0-100)
+  uint8_t red[NUM_FADERS];
+  uint8_t green[NUM_FADERS];
+  uint8_t blue[NUM_FADERS];
+};
+
+static PageCacheEntry pageCache[PAGE_CACHE_SLOTS];
+
+// Set once the console has sent state for the current page, so a page we
+// flipped past before it synced never caches another page's values
+static bool currentPageSynced = false;
+
+static PageCacheEntry *findEntry(int page) {
+  for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+    if (pageCache[i].page == page) return &pageCache[i];
+  }
+  return nullptr;
+}
+
+void pageCacheMarkSynced() {
+  currentPageSynced = true;
+}
+
+void pageCacheClear() {
+  for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+    pageCache[i].page = 0;
+  }
+  currentPageSynced = false;
+}
+
+void pageCacheStore(int page) {
+  if (page <= 0 || !currentPageSynced) return;
+
+  PageCacheEntry *entry = findEntry(page);
+
+  // Reuse an empty slot, else replace the least recently used page
+  if (!entry) {
+    entry = &pageCache[0];
+    for (int i = 0; i < PAGE_CACHE_SLOTS; i++) {
+      if (pageCache[i].page == 0) {
+        entry = &pageCache[i];
+        break;
+      }
+      if ((long)(pageCache[i].lastUsed - entry->lastUsed) < 0) {
+        entry = &pageCache[i];
+      }
+    }
+  }
+
+  entry->page = page;
+  entry->lastUsed = millis();
+  for (int i = 0; i < NUM_FADERS; i++) {
+    entry->value[i] = constrain((int)faders[i].setpoint, 0, 100);
+    entry->red[i] = faders[i].red;
+    entry->green[i] = faders[i].green;
+    entry->blue[i] = faders[i].blue;
+  }
+}
+
+bool pageCacheRecall(int page) {
+  // New page is unconfirmed until the console sends its state
+  currentPageSynced = false;
+
+  PageCacheEntry *entry = findEntry(page);
+  if (!entry) return false;
+
+  entry->lastUsed = millis();
+  for (int i = 0; i < NUM_FADERS; i++) {
+    if (faders[i].touched) continue;   // Never fight the operator's hand
+
+    queueFaderSetpoint(i, entry->value[i]);
+    faders[i].red = entry->red[i];
+    faders[i].green = entry->green[i];
+    faders[i].blue = entry->blue[i];
+    faders[i].colorUpdated = true;
+  }
+
+  debugPrintf("Page %d recalled from cache\n", page);
+  return true;
+}
@@ -0,0 +1,155 @@
+// Profiler.cpp
+
+#include "Profiler.h"
+
+#if PROFILER_ENABLED
+
+#if !defined(ARDUINO)
+#include <chrono>
+#endif
+
+//================================
+// CLOCK
+//================================
+
+#if defined(ARDUINO)
+uint32_t profilerTicksPerUs() {
+  return F_CPU_ACTUAL / 1000000;
+}
+#else
+// Host build, nanoseconds wrap like the cycle counter does
+uint32_t profilerTicks() {
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+uint32_t profilerTicksPerUs() {
+  return 1000;
+}
+#endif
+
+//================================
+// STORAGE
+//================================
+
+static ProfileZone *zones[PROFILER_MAX_ZONES];
+static int zoneCount = 0;
+static uint32_t unregisteredZones = 0;   // Ran but did not fit in the table
+static int nextDisplayZone = 0;
+
+//================================
+// RECORDING
+//================================
+
+void profilerRegister(ProfileZone &zone, const char *name) {
+  zone.name = name;
+  if (zoneCount < PROFILER_MAX_ZONES) {
+    zones[zoneCount++] = &zone;
+  } else {
+    unregisteredZones++;
+  }
+}
+
+// Bucket 0 is < 2^MIN_SHIFT, then four buckets per power of two
+static int bucketFor(uint32_t ticks) {
+  if (ticks < (1UL << PROFILER_MIN_SHIFT)) return 0;
+  int msb = 31 - __builtin_clz(ticks);
+  int quarter = (ticks >> (msb - 2)) & 3;
+  int bucket = 1 + (msb - PROFILER_MIN_SHIFT) * 4 + quarter;
+  return bucket < PROFILER_BUCKETS ? bucket : PROFILER_BUCKETS - 1;
+}
+
+// Exclusive upper edge of a bucket in ticks, 0 for the open ended last one
+static uint32_t bucketLimit(int bucket) {
+  if (bucket >= PROFILER_BUCKETS - 1) return 0;
+  if (bucket == 0) return 1UL << PROFILER_MIN_SHIFT;
+  int msb = (bucket - 1) / 4 + PROFILER_MIN_SHIFT;
+  int quarter = (bucket - 1) % 4;
+  return (uint32_t)((uint64_t)(5 + quarter) << (msb - 2));
+}
+
+void profilerRecord(ProfileZone &zone, uint32_t ticks) {
+  zone.buckets[bucketFor(ticks)]++;
+  if (zone.count == 0 || ticks < zone.minTicks) zone.minTicks = ticks;
+  if (ticks > zone.maxTicks) zone.maxTicks = ticks;
+  zone.totalTicks += ticks;
+  zone.count++;
+}
+
+//================================
+// QUERIES
+//================================
+
+static uint32_t zonePercentile(const ProfileZone &zone, int percent) {
+  if (zone.count == 0) return 0;
+
+  uint32_t target = ((uint64_t)zone.count * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (int i = 0; i < PROFILER_BUCKETS; i++) {
+    seen += zone.buckets[i];
+    if (seen >= target) {
+      uint32_t limit = bucketLimit(i);
+      return (limit && limit < zone.maxTicks) ? limit : zone.maxTicks;
+    }
+  }
+  return zone.maxTicks;
+}
+
+static uint32_t ticksToNanos(uint64_t ticks) {
+  return (uint32_t)(ticks * 1000 / profilerTicksPerUs());
+}
+
+//================================
+// REPORTING
+//================================
+
+void resetProfiler() {
+  for (int i = 0; i < zoneCount; i++) {
+    ProfileZone &zone = *zones[i];
+    memset(zone.buckets, 0, sizeof(zone.buckets));
+    zone.count = 0;
+    zone.minTicks = 0;
+    zone.maxTicks = 0;
+    zone.totalTicks = 0;
+  }
+}
+
+void printProfile(Print &out) {
+  for (int i = 0; i < zoneCount; i++) {
+    const ProfileZone &zone = *zones[i];
+    uint64_t avg = zone.count ? zone.totalTicks / zone.count : 0;
+    out.printf("[PROFILE] %s: n=%lu min=%lu avg=%lu p99<%lu max=%lu ns\n",
+               zone.name, (unsigned long)zone.count,
+               (unsigned long)ticksToNanos(zone.minTicks), (unsigned long)ticksToNanos(avg),
+               (unsigned long)ticksToNanos(zonePercentile(zone, 99)),
+               (unsigned long)ticksToNanos(zone.maxTicks));
+  }
+  if (unregisteredZones) {
+    out.printf("[PROFILE] %lu zones over PROFILER_MAX_ZONES not shown\n", (unsigned long)unregisteredZones);
+  }
+}
+
+bool formatProfileLine(char *buffer, size_t capacity) {
+  if (zoneCount == 0) return false;
+
+  const ProfileZone &zone = *zones[nextDisplayZone];
+  nextDisplayZone = (nextDisplayZone + 1) % zoneCount;
+  snprintf(buffer, capacity, "%.10s %luus", zone.name,
+           (unsigned long)(ticksToNanos(zonePercentile(zone, 99)) / 1000));
+  return true;
+}
+
+#else
+
+void resetProfiler() {
+}
+
+void printProfile(Print &out) {
+  out.println("[PROFILE] profiler disabled in this build");
+}
+
+bool formatProfileLine(char *, size_t) {
+  return false;
+}
+
+#endif // PROFILER_ENABLED
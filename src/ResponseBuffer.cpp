@@ -0,0 +1,34 @@
+// ResponseBuffer.cpp
+
+#include "ResponseBuffer.h"
+
+ResponseBuffer::ResponseBuffer()
+  : buf(nullptr), cap(0), len(0), overflow(false) {
+}
+
+void ResponseBuffer::attach(uint8_t *buffer, size_t capacity) {
+  buf = buffer;
+  cap = capacity;
+  len = 0;
+  overflow = false;
+}
+
+size_t ResponseBuffer::write(uint8_t b) {
+  if (len >= cap) {
+    overflow = true;
+    return 0;
+  }
+  buf[len++] = b;
+  return 1;
+}
+
+size_t ResponseBuffer::write(const uint8_t *data, size_t size) {
+  size_t room = cap - len;
+  if (size > room) {
+    size = room;
+    overflow = true;
+  }
+  memcpy(buf + len, data, size);
+  len += size;
+  return size;
+}
@@ -0,0 +1,129 @@
+// Scheduler.cpp
+
+#include "Scheduler.h"
+
+//================================
+// STORAGE
+//================================
+
+static Task tasks[SCHEDULER_MAX_TASKS];
+static int taskCount = 0;
+
+static uint32_t cyclesToMicros(uint64_t cycles) {
+  return (uint32_t)(cycles / (F_CPU_ACTUAL / 1000000));
+}
+
+//================================
+// REGISTRATION
+//================================
+
+bool addTask(const char *name, TaskFunction run, uint32_t periodUs,
+             TaskPriority priority, uint32_t budgetUs) {
+  if (taskCount >= SCHEDULER_MAX_TASKS) return false;
+
+  Task &t = tasks[taskCount++];
+  memset(&t, 0, sizeof(t));
+  t.name = name;
+  t.run = run;
+  t.periodUs = periodUs;
+  t.budgetUs = budgetUs;
+  t.priority = priority;
+  t.lastStart = micros() - periodUs;   // Due on the first pass
+  return true;
+}
+
+//================================
+// RUNNING
+//================================
+
+// How long past its due time a task is, -1 if not due yet
+static int32_t taskLateness(const Task &t, uint32_t now) {
+  int32_t late = (int32_t)(now - t.lastStart) - (int32_t)t.periodUs;
+  return late >= 0 ? late : -1;
+}
+
+// One priority level up for every full period a task has waited past its
+// due time, never above TASK_HIGH, so a busy higher priority task cannot
+// keep a lower one from running forever
+static TaskPriority agedPriority(const Task &t, int32_t late) {
+  if (t.periodUs == 0) return t.priority;
+  uint32_t levels = (uint32_t)late / t.periodUs;
+  if (levels >= (uint32_t)(t.priority - TASK_HIGH)) return TASK_HIGH;
+  return (TaskPriority)(t.priority - levels);
+}
+
+static void runTask(Task &t, uint32_t now, int32_t late) {
+  if ((uint32_t)late > t.maxLateUs) t.maxLateUs = late;
+  t.lastStart = now;
+
+  uint32_t start = ARM_DWT_CYCCNT;
+  {
+    ProfileScope scope(t.zone, t.name);
+    t.run();
+  }
+  uint32_t cycles = ARM_DWT_CYCCNT - start;
+
+  t.runs++;
+  t.totalCycles += cycles;
+  if (cycles > t.maxCycles) t.maxCycles = cycles;
+  if (cyclesToMicros(cycles) > t.budgetUs) t.overruns++;
+}
+
+void runScheduler() {
+  // Critical tasks first, all of them that are due
+  for (int i = 0; i < taskCount; i++) {
+    Task &t = tasks[i];
+    if (t.priority != TASK_CRITICAL) continue;
+    uint32_t now = micros();
+    int32_t late = taskLateness(t, now);
+    if (late >= 0) runTask(t, now, late);
+  }
+
+  // Then the single most urgent of the rest
+  uint32_t now = micros();
+  Task *next = nullptr;
+  int32_t nextLate = -1;
+  TaskPriority nextPriority = TASK_LOW;
+  for (int i = 0; i < taskCount; i++) {
+    Task &t = tasks[i];
+    if (t.priority == TASK_CRITICAL) continue;
+    int32_t late = taskLateness(t, now);
+    if (late < 0) continue;
+    TaskPriority priority = agedPriority(t, late);
+    if (next == nullptr || priority < nextPriority ||
+        (priority == nextPriority && late > nextLate)) {
+      next = &t;
+      nextLate = late;
+      nextPriority = priority;
+    }
+  }
+  if (next) runTask(*next, now, nextLate);
+}
+
+//================================
+// REPORTING
+//================================
+
+void resetTaskStats() {
+  for (int i = 0; i < taskCount; i++) {
+    Task &t = tasks[i];
+    t.runs = 0;
+    t.overruns = 0;
+    t.maxCycles = 0;
+    t.totalCycles = 0;
+    t.maxLateUs = 0;
+  }
+}
+
+void printTaskStats(Print &out) {
+  for (int i = 0; i < taskCount; i++) {
+    const Task &t = tasks[i];
+    uint32_t avg = t.runs ? cyclesToMicros(t.totalCycles / t.runs) : 0;
+    out.printf("task_%s_runs %lu\n", t.name, (unsigned long)t.runs);
+    out.printf("task_%s_overruns %lu\n", t.name, (unsigned long)t.overruns);
+    out.printf("task_%s_budget_us %lu\n", t.name, (unsigned long)t.budgetUs);
+    out.printf("task_%s_avg_us %lu\n", t.name, (unsigned long)avg);
+    out.printf("task_%s_max_us %lu\n", t.name, (unsigned long)cyclesToMicros(t.maxCycles));
+    out.printf("task_%s_max_late_us %lu\n", t.name, (unsigned long)t.maxLateUs);
+  }
+}
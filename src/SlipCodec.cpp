@@ -0,0 +1,87 @@
+// SlipCodec.cpp
+
+#include "SlipCodec.h"
+
+//================================
+// ENCODER
+//================================
+
+size_t slipEncode(const uint8_t *data, size_t size, uint8_t *out, size_t capacity) {
+  size_t n = 0;
+
+  if (capacity < 2) return 0;
+  out[n++] = SLIP_END;
+
+  for (size_t i = 0; i < size; i++) {
+    uint8_t b = data[i];
+    if (b == SLIP_END || b == SLIP_ESC) {
+      if (n + 2 >= capacity) return 0;
+      out[n++] = SLIP_ESC;
+      out[n++] = (b == SLIP_END) ? SLIP_ESC_END : SLIP_ESC_ESC;
+    } else {
+      if (n + 1 >= capacity) return 0;
+      out[n++] = b;
+    }
+  }
+
+  out[n++] = SLIP_END;
+  return n;
+}
+
+//================================
+// STREAMING DECODER
+//================================
+
+SlipDecoder::SlipDecoder(uint8_t *buffer, size_t capacity)
+  : buf(buffer), cap(capacity), len(0), escaped(false),
+    overflow(false), ready(false), dropped(0) {
+}
+
+void SlipDecoder::reset() {
+  len = 0;
+  escaped = false;
+  overflow = false;
+  ready = false;
+}
+
+bool SlipDecoder::feed(uint8_t byte) {
+  // Previous frame has been handed out, start a new one
+  if (ready) {
+    len = 0;
+    ready = false;
+  }
+
+  if (byte == SLIP_END) {
+    escaped = false;
+    if (overflow) {
+      overflow = false;
+      len = 0;
+      dropped++;
+      return false;
+    }
+    if (len == 0) return false;   // Leading END or back to back ENDs
+    ready = true;
+    return true;
+  }
+
+  if (escaped) {
+    escaped = false;
+    if (byte == SLIP_ESC_END) {
+      byte = SLIP_END;
+    } else if (byte == SLIP_ESC_ESC) {
+      byte = SLIP_ESC;
+    }
+    // Anything else is a protocol error, RFC 1055 keeps the byte as is
+  } else if (byte == SLIP_ESC) {
+    escaped = true;
+    return false;
+  }
+
+  if (overflow) return false;
+  if (len >= cap) {
+    overflow = true;
+    return false;
+  }
+  buf[len++] = byte;
+  return false;
+}
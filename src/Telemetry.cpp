@@ -0,0 +1,57 @@
+// Telemetry.cpp
+
+#include "Telemetry.h"
+#include "Config.h"
+#include "FaderControl.h"
+
+//================================
+// LOOP TIMING
+//================================
+// Collected between two frames, reset when a frame is built
+
+static uint32_t loopPasses = 0;
+static uint64_t loopTotalCycles = 0;
+static uint32_t loopMaxCycles = 0;
+
+void telemetryRecordLoop(uint32_t cycles) {
+  loopPasses++;
+  loopTotalCycles += cycles;
+  if (cycles > loopMaxCycles) loopMaxCycles = cycles;
+}
+
+//================================
+// FRAMES
+//================================
+
+// Faders being moved or touched are read by the control code anyway,
+// refreshing one per frame keeps idle ones current without a full sweep
+static int nextRefresh = 0;
+
+size_t buildTelemetryFrame(char *buffer, size_t capacity) {
+  readFadertoOSC(faders[nextRefresh]);
+  nextRefresh = (nextRefresh + 1) % NUM_FADERS;
+
+  const uint32_t cyclesPerUs = F_CPU_ACTUAL / 1000000;
+  uint32_t avgUs = loopPasses ? (uint32_t)(loopTotalCycles / loopPasses / cyclesPerUs) : 0;
+
+  int length = snprintf(buffer, capacity, "data: {\"t\":%lu,\"loop\":[%lu,%lu,%lu],\"f\":[",
+                        millis(), (unsigned long)avgUs,
+                        (unsigned long)(loopMaxCycles / cyclesPerUs), (unsigned long)loopPasses);
+
+  for (int i = 0; i < NUM_FADERS && length > 0 && (size_t)length < capacity; i++) {
+    const Fader &f = faders[i];
+    int raw = (int)f.current;
+    int position = (f.maxVal > f.minVal) ? constrain(map(raw, f.minVal, f.maxVal, 0, 100), 0, 100) : 0;
+    length += snprintf(buffer + length, capacity - length, "%s[%d,%d,%d,%d,%d]", i ? "," : "",
+                       position, (int)f.setpoint, (int)f.motorOutput, f.touched ? 1 : 0, raw);
+  }
+  if (length > 0 && (size_t)length < capacity) {
+    length += snprintf(buffer + length, capacity - length, "]}\n\n");
+  }
+  if (length <= 0 || (size_t)length >= capacity) return 0;
+
+  loopPasses = 0;
+  loopTotalCycles = 0;
+  loopMaxCycles = 0;
+  return length;
+}
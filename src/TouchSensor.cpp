@@ -2,6 +2,7 @@
 
 #include "TouchSensor.h"
 #include "Utils.h"
+#include "Profiler.h"
 
 //================================
 // GLOBAL VARIABLES DEFINITIONS
@@ -19,7 +20,8 @@ unsigned long lastTouchDebugTime = 0;
 // Interrupt and error handling
 volatile bool touchStateChanged = false;
 bool touchErrorOccurred = false;
-String lastTouchError = "";
+bool touchSetupPending = false;   // Settings changed from the web, reinit from the touch task
+FixedString<64> lastTouchError;
 int reinitializationAttempts = 0;
 unsigned long lastReinitTime = 0;
 const int MAX_REINIT_ATTEMPTS = 5;
@@ -48,12 +50,15 @@ void updateTouchTiming(int i, bool newTouchState) {
   if (newTouchState && !faders[i].touched) {
     faders[i].touchStartTime = currentTime;
     faders[i].touchDuration = 0;
+    faders[i].touchStartMicros = micros();
+    faders[i].touchLatencyPending = true;
   }
   // If state changed from touched to released
   else if (!newTouchState && faders[i].touched) {
     faders[i].releaseTime = currentTime;
     // Calculate how long it was touched
     faders[i].touchDuration = currentTime - faders[i].touchStartTime;
+    faders[i].touchLatencyPending = false;   // Touched without moving, nothing to measure
   }
   // If continuing to be touched, update duration
   else if (newTouchState && faders[i].touched) {
@@ -77,7 +82,8 @@ bool setupTouch() {
   // Try to initialize the MPR121 sensor
   if (!mpr121.begin(MPR121_ADDRESS)) {
     touchErrorOccurred = true;
-    lastTouchError = "MPR121 not found at address 0x5A. Check wiring!";
+    lastTouchError.clear();
+    lastTouchError.print("MPR121 not found at address 0x5A. Check wiring!");
     return false;
   }
   
@@ -104,7 +110,18 @@ bool setupTouch() {
 // MAIN PROCESSING FUNCTION
 //================================
 
+// Web handlers ask for this instead of resetting the MPR121 themselves
+void requestTouchSetup() {
+  touchSetupPending = true;
+}
+
 bool processTouchChanges() {
+  PROFILE_ZONE("touch_read");
+  if (touchSetupPending) {
+    touchSetupPending = false;
+    setupTouch();   // A failure is reported through touchErrorOccurred
+  }
+
   //static uint16_t lastRawTouchBits = 0;
   uint16_t currentTouches = mpr121.touched();
   unsigned long now = millis();
@@ -210,7 +227,8 @@ void setAutoTouchCalibration(int mode) {
   // Validate input
   if (mode < 0 || mode > 2) {
     touchErrorOccurred = true;
-    lastTouchError = "Invalid auto-calibration mode. Use 0-2.";
+    lastTouchError.clear();
+    lastTouchError.print("Invalid auto-calibration mode. Use 0-2.");
     return;
   }
   
@@ -289,7 +307,8 @@ void handleTouchError() {
   
   // Check if we've exceeded maximum attempts
   if (reinitializationAttempts >= MAX_REINIT_ATTEMPTS) {
-    lastTouchError = "MPR121 failed after " + String(MAX_REINIT_ATTEMPTS) + " reinit attempts";
+    lastTouchError.clear();
+    lastTouchError.printf("MPR121 failed after %d reinit attempts", MAX_REINIT_ATTEMPTS);
     return;
   }
   
@@ -304,7 +323,8 @@ void handleTouchError() {
   delay(50);
   
   if (!mpr121.begin(MPR121_ADDRESS)) {
-    lastTouchError = "MPR121 reinit failed (attempt " + String(reinitializationAttempts) + ")";
+    lastTouchError.clear();
+    lastTouchError.printf("MPR121 reinit failed (attempt %d)", reinitializationAttempts);
     return;
   }
   
@@ -314,11 +334,12 @@ void handleTouchError() {
   
   // Clear error only if we were successful
   touchErrorOccurred = false;
-  lastTouchError = "Recovered from error after " + String(reinitializationAttempts) + " attempts";
+  lastTouchError.clear();
+  lastTouchError.printf("Recovered from error after %d attempts", reinitializationAttempts);
 }
 
-String getLastTouchError() {
-  return lastTouchError;
+const char *getLastTouchError() {
+  return lastTouchError.c_str();
 }
 
 bool hasTouchError() {
@@ -327,7 +348,7 @@ bool hasTouchError() {
 
 void clearTouchError() {
   touchErrorOccurred = false;
-  lastTouchError = "";
+  lastTouchError.clear();
   reinitializationAttempts = 0;
 }
 
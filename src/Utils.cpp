@@ -3,6 +3,10 @@
 #include "OLED.h"
 #include "Utils.h"
 #include "Config.h"
+#include "LatencyStats.h"
+#include "Metrics.h"
+#include "Arena.h"
+#include "Profiler.h"
 #include <stdarg.h>
 
 extern OLED display;
@@ -42,41 +46,31 @@ void debugPrintf(const char* format, ...) {
 // IP ADDRESS UTILITIES
 //================================
 
-String ipToString(IPAddress ip) {
-  char buf[16];
-  sprintf(buf, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
-  return String(buf);
-}
-
-IPAddress stringToIP(const String &str) {
-  int parts[4] = {0};
-  sscanf(str.c_str(), "%d.%d.%d.%d", &parts[0], &parts[1], &parts[2], &parts[3]);
-  return IPAddress(parts[0], parts[1], parts[2], parts[3]);
-}
-
-//================================
-// WEB PARAMETER PARSING
-//================================
-
-String getParam(String data, const char* key) {
-  int start = data.indexOf(String(key) + "=");
-  if (start == -1) return "";
-  start += strlen(key) + 1;
-  int end = data.indexOf('&', start);
-  if (end == -1) end = data.length();
-  return data.substring(start, end);
+IPString ipToString(IPAddress ip) {
+  IPString text;
+  text.printf("%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+  return text;
 }
 
 //================================
 // UPLOAD Function 
 //================================
+// Commands are collected a character at a time, no String and no blocking read
+static FixedString<32> serialCommand;
+
 //Upload without pressing button, using python script, takes one second try
 void checkSerialForReboot() {
-    if (Serial.available()) {
-        String cmd = Serial.readStringUntil('\n');
-        cmd.trim(); // Remove any whitespace/newlines
-        
-        if (cmd == "REBOOT_BOOTLOADER") {
+    while (Serial.available()) {
+        char c = Serial.read();
+        if (c == '\r') continue;
+        if (c != '\n') {
+            serialCommand.write((uint8_t)c);
+            continue;
+        }
+
+        FixedString<32> &cmd = serialCommand;
+
+        if (cmd.equals("REBOOT_BOOTLOADER")) {
             Serial.println("[REBOOT] Command received. Entering bootloader...");
             Serial.flush(); // Important: ensure message is sent before reboot
             delay(100);
@@ -84,7 +78,7 @@ void checkSerialForReboot() {
             // This is the correct method for ALL Teensy models
             _reboot_Teensyduino_();
             
-        } else if (cmd == "REBOOT_NORMAL") {
+        } else if (cmd.equals("REBOOT_NORMAL")) {
             Serial.println("[REBOOT] Normal reboot requested...");
             Serial.flush();
             delay(100);
@@ -92,10 +86,35 @@ void checkSerialForReboot() {
             // Normal restart using ARM AIRCR register
             SCB_AIRCR = 0x05FA0004;
             
+        } else if (cmd.equals("LATENCY")) {
+            printLatencyStats(Serial);
+
+        } else if (cmd.equals("METRICS")) {
+            printMetrics(Serial);
+
+        } else if (cmd.equals("METRICS_RESET")) {
+            resetMetrics();
+            Serial.println("[METRICS] Counters reset");
+
+        } else if (cmd.equals("LATENCY_RESET")) {
+            resetLatencyStats();
+            Serial.println("[LATENCY] Histograms reset");
+
+        } else if (cmd.equals("HEAP")) {
+            printHeapReport(Serial);
+
+        } else if (cmd.equals("PROFILE")) {
+            printProfile(Serial);
+
+        } else if (cmd.equals("PROFILE_RESET")) {
+            resetProfiler();
+            Serial.println("[PROFILE] Zones reset");
+
         } else {
             Serial.print("[REBOOT] Unknown command: ");
-            Serial.println(cmd);
+            Serial.println(cmd.c_str());
         }
+        serialCommand.clear();
     }
 }
 
@@ -0,0 +1,490 @@
+// WebApi.cpp - JSON REST API under /api/v1
+
+#include "WebApi.h"
+#include "WebServer.h"
+#include "Utils.h"
+#include "Config.h"
+#include "EEPROMStorage.h"
+#include "FaderControl.h"
+#include "TouchSensor.h"
+#include "NetworkOSC.h"
+#include "NeoPixelControl.h"
+#include "OLED.h"
+#include "FormParser.h"
+#include <ArduinoJson.h>
+
+//================================
+// STATE
+//================================
+
+// One request is handled at a time, requests and responses share this
+static StaticJsonDocument<API_JSON_CAPACITY> apiDoc;
+
+// Field that failed validation, reported in the 400 body
+static const char *apiErrorField = nullptr;
+
+// Working copy of everything the API can change. A PUT is validated into
+// this and only copied to the live config when every field passed.
+struct ApiConfig {
+  FaderConfig fader;
+  NetworkConfig network;
+  OscDestination destinations[OSC_MAX_DESTINATIONS];
+  TouchConfig touch;
+  int calibrationMin[NUM_FADERS];
+  int calibrationMax[NUM_FADERS];
+};
+
+enum ApiSectionFlag : uint8_t {
+  API_SECTION_FADER       = 0x01,
+  API_SECTION_NETWORK     = 0x02,
+  API_SECTION_TOUCH       = 0x04,
+  API_SECTION_CALIBRATION = 0x08
+};
+
+static void captureConfig(ApiConfig &cfg) {
+  cfg.fader = Fconfig;
+  cfg.network = netConfig;
+  for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+    cfg.destinations[d] = oscDestinations[d];   // IPAddress has a vtable, no memcpy
+  }
+  cfg.touch.autoCalibrationMode = autoCalibrationMode;
+  cfg.touch.touchThreshold = touchThreshold;
+  cfg.touch.releaseThreshold = releaseThreshold;
+  for (int i = 0; i < NUM_FADERS; i++) {
+    cfg.calibrationMin[i] = faders[i].minVal;
+    cfg.calibrationMax[i] = faders[i].maxVal;
+  }
+}
+
+// Apply the accepted sections, then save them to EEPROM as one journaled
+// write so a power loss keeps either all of the old values or all of the
+// new ones. Hardware is reset after the save, the MPR121 from its own task.
+static void commitConfig(const ApiConfig &cfg, uint8_t sections) {
+  bool brightnessChanged = false;
+
+  if (sections & API_SECTION_FADER) {
+    brightnessChanged = cfg.fader.baseBrightness != Fconfig.baseBrightness;
+    Fconfig = cfg.fader;
+    debugMode = Fconfig.serialDebug;
+  }
+
+  if (sections & API_SECTION_CALIBRATION) {
+    for (int i = 0; i < NUM_FADERS; i++) {
+      faders[i].minVal = cfg.calibrationMin[i];
+      faders[i].maxVal = cfg.calibrationMax[i];
+    }
+  }
+
+  if (sections & API_SECTION_TOUCH) {
+    autoCalibrationMode = cfg.touch.autoCalibrationMode;
+    touchThreshold = cfg.touch.touchThreshold;
+    releaseThreshold = cfg.touch.releaseThreshold;
+  }
+
+  if (sections & API_SECTION_NETWORK) {
+    netConfig = cfg.network;
+    for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+      oscDestinations[d] = cfg.destinations[d];
+    }
+  }
+
+  beginConfigJournal();
+  if (sections & API_SECTION_FADER) saveFaderConfig();
+  if (sections & API_SECTION_CALIBRATION) saveCalibration();
+  if (sections & API_SECTION_TOUCH) saveTouchConfig();
+  if (sections & API_SECTION_NETWORK) {
+    saveNetworkConfig();
+    saveOscDestinations();
+  }
+  commitConfigJournal();
+
+  if (sections & API_SECTION_FADER) {
+    if (!debugMode) display.clearDebugLines();
+    if (brightnessChanged) updateBaseBrightnessPixels();
+  }
+
+  // setupTouch() applies the thresholds and calibration mode
+  if (sections & API_SECTION_TOUCH) {
+    requestTouchSetup();
+  }
+
+  // Static IP changes need a restart, the OSC ports and destinations apply now
+  if (sections & API_SECTION_NETWORK) {
+    restartUDP();
+  }
+}
+
+//================================
+// FIELD VALIDATION
+//================================
+// Fields that are left out keep their value. Wrong types and out of range
+// values fail the whole request.
+
+static bool fieldError(const char *key) {
+  apiErrorField = key;
+  return false;
+}
+
+template <typename T>
+static bool readNumber(JsonObjectConst obj, const char *key, long minValue, long maxValue, T &target) {
+  JsonVariantConst value = obj[key];
+  if (value.isNull()) return true;
+  if (!value.is<long>() || value.as<long>() < minValue || value.as<long>() > maxValue) {
+    return fieldError(key);
+  }
+  target = (T)value.as<long>();
+  return true;
+}
+
+static bool readBool(JsonObjectConst obj, const char *key, bool &target) {
+  JsonVariantConst value = obj[key];
+  if (value.isNull()) return true;
+  if (!value.is<bool>()) return fieldError(key);
+  target = value.as<bool>();
+  return true;
+}
+
+static bool readIP(JsonObjectConst obj, const char *key, IPAddress &target) {
+  JsonVariantConst value = obj[key];
+  if (value.isNull()) return true;
+  if (!value.is<const char *>() || !formParseIP(value.as<const char *>(), target)) {
+    return fieldError(key);
+  }
+  return true;
+}
+
+//================================
+// SECTIONS
+//================================
+
+static bool parseFader(JsonObjectConst obj, ApiConfig &cfg) {
+  FaderConfig &f = cfg.fader;
+  if (!(readNumber(obj, "minPwm", 0, 255, f.minPwm) &&
+        readNumber(obj, "defaultPwm", 0, 255, f.defaultPwm) &&
+        readNumber(obj, "calibratePwm", 0, 255, f.calibratePwm) &&
+        readNumber(obj, "targetTolerance", 0, 100, f.targetTolerance) &&
+        readNumber(obj, "sendTolerance", 0, 100, f.sendTolerance) &&
+        readNumber(obj, "baseBrightness", 0, 255, f.baseBrightness) &&
+        readNumber(obj, "touchedBrightness", 0, 255, f.touchedBrightness) &&
+        readNumber(obj, "fadeTime", 0, 60000, f.fadeTime) &&
+        readBool(obj, "serialDebug", f.serialDebug))) {
+    return false;
+  }
+  if (f.minPwm > f.defaultPwm) return fieldError("minPwm");
+  return true;
+}
+
+static void writeFader(JsonObject obj, const ApiConfig &cfg) {
+  const FaderConfig &f = cfg.fader;
+  obj["minPwm"] = f.minPwm;
+  obj["defaultPwm"] = f.defaultPwm;
+  obj["calibratePwm"] = f.calibratePwm;
+  obj["targetTolerance"] = f.targetTolerance;
+  obj["sendTolerance"] = f.sendTolerance;
+  obj["baseBrightness"] = f.baseBrightness;
+  obj["touchedBrightness"] = f.touchedBrightness;
+  obj["fadeTime"] = f.fadeTime;
+  obj["serialDebug"] = f.serialDebug;
+}
+
+static bool parseNetwork(JsonObjectConst obj, ApiConfig &cfg) {
+  NetworkConfig &n = cfg.network;
+  if (!(readBool(obj, "useDHCP", n.useDHCP) &&
+        readIP(obj, "staticIP", n.staticIP) &&
+        readIP(obj, "gateway", n.gateway) &&
+        readIP(obj, "subnet", n.subnet) &&
+        readIP(obj, "sendToIP", n.sendToIP) &&
+        readNumber(obj, "sendPort", 1, 65535, n.sendPort) &&
+        readNumber(obj, "receivePort", 1, 65535, n.receivePort) &&
+        readBool(obj, "sendTcp", n.sendTcp))) {
+    return false;
+  }
+  if (!isValidIP(n.staticIP)) return fieldError("staticIP");
+  if (!isValidIP(n.gateway)) return fieldError("gateway");
+  if (!isValidIP(n.subnet)) return fieldError("subnet");
+  if (!isValidIP(n.sendToIP)) return fieldError("sendToIP");
+
+  // Extra destinations by index, a shorter list leaves the rest alone
+  JsonVariantConst list = obj["destinations"];
+  if (list.isNull()) return true;
+  JsonArrayConst entries = list.as<JsonArrayConst>();
+  if (entries.isNull() || entries.size() > OSC_MAX_DESTINATIONS) return fieldError("destinations");
+
+  int d = 0;
+  for (JsonVariantConst item : entries) {
+    JsonObjectConst entry = item.as<JsonObjectConst>();
+    OscDestination &dest = cfg.destinations[d++];
+    if (entry.isNull() ||
+        !(readBool(entry, "enabled", dest.enabled) &&
+          readIP(entry, "ip", dest.ip) &&
+          readNumber(entry, "port", 0, 65535, dest.port) &&
+          readBool(entry, "broadcast", dest.broadcast) &&
+          readBool(entry, "tcp", dest.tcp)) ||
+        (dest.enabled && ((!dest.broadcast && !isValidIP(dest.ip)) || !isValidPort(dest.port)))) {
+      return fieldError("destinations");
+    }
+  }
+  return true;
+}
+
+static void writeNetwork(JsonObject obj, const ApiConfig &cfg) {
+  const NetworkConfig &n = cfg.network;
+  obj["useDHCP"] = n.useDHCP;
+  // data() is a char *, so ArduinoJson copies the temporary text into apiDoc
+  obj["staticIP"] = ipToString(n.staticIP).data();
+  obj["gateway"] = ipToString(n.gateway).data();
+  obj["subnet"] = ipToString(n.subnet).data();
+  obj["sendToIP"] = ipToString(n.sendToIP).data();
+  obj["sendPort"] = n.sendPort;
+  obj["receivePort"] = n.receivePort;
+  obj["sendTcp"] = n.sendTcp;
+
+  JsonArray list = obj.createNestedArray("destinations");
+  for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+    const OscDestination &dest = cfg.destinations[d];
+    JsonObject entry = list.createNestedObject();
+    entry["enabled"] = dest.enabled;
+    entry["ip"] = ipToString(dest.ip).data();
+    entry["port"] = dest.port;
+    entry["broadcast"] = dest.broadcast;
+    entry["tcp"] = dest.tcp;
+  }
+}
+
+static bool parseTouch(JsonObjectConst obj, ApiConfig &cfg) {
+  TouchConfig &t = cfg.touch;
+  if (!(readNumber(obj, "autoCalibrationMode", 0, 2, t.autoCalibrationMode) &&
+        readNumber(obj, "touchThreshold", 1, 255, t.touchThreshold) &&
+        readNumber(obj, "releaseThreshold", 1, 255, t.releaseThreshold))) {
+    return false;
+  }
+  if (t.releaseThreshold >= t.touchThreshold) return fieldError("releaseThreshold");
+  return true;
+}
+
+static void writeTouch(JsonObject obj, const ApiConfig &cfg) {
+  obj["autoCalibrationMode"] = cfg.touch.autoCalibrationMode;
+  obj["touchThreshold"] = cfg.touch.touchThreshold;
+  obj["releaseThreshold"] = cfg.touch.releaseThreshold;
+}
+
+static bool parseCalibration(JsonObjectConst obj, ApiConfig &cfg) {
+  JsonVariantConst list = obj["faders"];
+  if (list.isNull()) return true;
+  JsonArrayConst entries = list.as<JsonArrayConst>();
+  if (entries.isNull() || entries.size() > NUM_FADERS) return fieldError("faders");
+
+  int i = 0;
+  for (JsonVariantConst item : entries) {
+    JsonObjectConst entry = item.as<JsonObjectConst>();
+    if (entry.isNull() ||
+        !(readNumber(entry, "min", 0, 1023, cfg.calibrationMin[i]) &&
+          readNumber(entry, "max", 0, 1023, cfg.calibrationMax[i])) ||
+        cfg.calibrationMin[i] >= cfg.calibrationMax[i]) {
+      return fieldError("faders");
+    }
+    i++;
+  }
+  return true;
+}
+
+static void writeCalibration(JsonObject obj, const ApiConfig &cfg) {
+  JsonArray list = obj.createNestedArray("faders");
+  for (int i = 0; i < NUM_FADERS; i++) {
+    JsonObject entry = list.createNestedObject();
+    entry["min"] = cfg.calibrationMin[i];
+    entry["max"] = cfg.calibrationMax[i];
+  }
+}
+
+struct ApiSection {
+  const char *path;     // Own endpoint, after /api/v1
+  const char *key;      // Key in the combined /config document
+  uint8_t flag;
+  bool (*parse)(JsonObjectConst obj, ApiConfig &cfg);
+  void (*write)(JsonObject obj, const ApiConfig &cfg);
+};
+
+static const ApiSection apiSections[] = {
+  { "/config/fader",   "fader",       API_SECTION_FADER,       parseFader,       writeFader },
+  { "/config/network", "network",     API_SECTION_NETWORK,     parseNetwork,     writeNetwork },
+  { "/config/touch",   "touch",       API_SECTION_TOUCH,       parseTouch,       writeTouch },
+  { "/calibration",    "calibration", API_SECTION_CALIBRATION, parseCalibration, writeCalibration },
+};
+
+//================================
+// RESPONSES
+//================================
+
+static void sendApiDocument(const char *status) {
+  client.printf("HTTP/1.1 %s\r\n", status);
+  client.println("Content-Type: application/json");
+  client.println("Cache-Control: no-store");
+  client.printf("Content-Length: %u\r\n", (unsigned)measureJson(apiDoc));
+  client.println("Connection: close");
+  client.println();
+  serializeJson(apiDoc, client);
+}
+
+static void sendApiError(const char *status, const char *message, const char *field = nullptr) {
+  apiDoc.clear();
+  apiDoc["error"] = message;
+  if (field) apiDoc["field"] = field;
+  sendApiDocument(status);
+}
+
+static void writeFaderState(JsonArray list) {
+  for (int i = 0; i < NUM_FADERS; i++) {
+    Fader &f = faders[i];
+    JsonObject entry = list.createNestedObject();
+    entry["oscId"] = f.oscID;
+    entry["position"] = readFadertoOSC(f);
+    entry["current"] = (int)f.current;
+    entry["setpoint"] = (int)f.setpoint;
+    entry["touched"] = f.touched;
+    JsonArray color = entry.createNestedArray("color");
+    color.add(f.red);
+    color.add(f.green);
+    color.add(f.blue);
+  }
+}
+
+static void writeCalibrationJob(JsonObject obj) {
+  const CalibrationJob &job = getCalibrationJob();
+  bool running = calibrationRunning();
+  obj["running"] = running;
+  obj["phase"] = calibrationPhaseName(job.phase);
+  obj["fader"] = running ? job.fader : -1;
+  obj["progress"] = calibrationProgress();
+  obj["cancelled"] = job.cancelled;
+  obj["finished"] = job.finished;
+  JsonArray list = obj.createNestedArray("faders");
+  for (int i = 0; i < NUM_FADERS; i++) {
+    JsonObject entry = list.createNestedObject();
+    entry["outcome"] = calibrationOutcomeName((CalibrationOutcome)job.outcome[i]);
+    entry["min"] = job.minVal[i];
+    entry["max"] = job.maxVal[i];
+  }
+}
+
+//================================
+// REQUEST HANDLING
+//================================
+
+void handleApiRequest(const char *method, const char *path, char *body, size_t bodyLength) {
+  bool isGet = strcmp(method, "GET") == 0;
+  bool isPut = strcmp(method, "PUT") == 0;
+  debugPrintf("API: %s %s\n", method, path);
+
+  if (strcmp(path, "/faders") == 0) {
+    if (!isGet) {
+      sendApiError("405 Method Not Allowed", "method not allowed");
+      return;
+    }
+    apiDoc.clear();
+    writeFaderState(apiDoc.createNestedArray("faders"));
+    sendApiDocument("200 OK");
+    return;
+  }
+
+  if (strcmp(path, "/calibration/job") == 0) {
+    if (strcmp(method, "POST") == 0) {
+      if (!startCalibration()) {
+        sendApiError("409 Conflict", "calibration already running");
+        return;
+      }
+    } else if (strcmp(method, "DELETE") == 0) {
+      cancelCalibration();
+    } else if (!isGet) {
+      sendApiError("405 Method Not Allowed", "method not allowed");
+      return;
+    }
+    apiDoc.clear();
+    writeCalibrationJob(apiDoc.to<JsonObject>());
+    sendApiDocument(strcmp(method, "POST") == 0 ? "202 Accepted" : "200 OK");
+    return;
+  }
+
+  // Either every section (/config) or a single one
+  bool allSections = strcmp(path, "/config") == 0;
+  const ApiSection *section = nullptr;
+  for (const ApiSection &s : apiSections) {
+    if (strcmp(s.path, path) == 0) section = &s;
+  }
+  if (!allSections && section == nullptr) {
+    sendApiError("404 Not Found", "no such endpoint");
+    return;
+  }
+  if (!isGet && !isPut) {
+    sendApiError("405 Method Not Allowed", "method not allowed");
+    return;
+  }
+
+  // Request scratch, too big to want on the stack
+  ApiConfig *scratch = arenaAllocArray<ApiConfig>(webRequestArena());
+  if (scratch == nullptr) {
+    sendApiError("500 Internal Server Error", "out of request memory");
+    return;
+  }
+  ApiConfig &cfg = *scratch;
+  captureConfig(cfg);
+
+  if (isPut) {
+    apiDoc.clear();
+    DeserializationError error = deserializeJson(apiDoc, body, bodyLength);
+    if (error) {
+      sendApiError("400 Bad Request", error.c_str());
+      return;
+    }
+    JsonObjectConst root = apiDoc.as<JsonObjectConst>();
+    if (root.isNull()) {
+      sendApiError("400 Bad Request", "expected a JSON object");
+      return;
+    }
+
+    // Validate every section before touching the live config
+    uint8_t sections = 0;
+    for (const ApiSection &s : apiSections) {
+      JsonObjectConst obj = root;
+      if (allSections) {
+        JsonVariantConst value = root[s.key];
+        if (value.isNull()) continue;
+        obj = value.as<JsonObjectConst>();
+        if (obj.isNull()) {
+          sendApiError("400 Bad Request", "expected an object", s.key);
+          return;
+        }
+      } else if (&s != section) {
+        continue;
+      }
+
+      apiErrorField = nullptr;
+      if (!s.parse(obj, cfg)) {
+        debugPrintf("API: invalid field %s\n", apiErrorField);
+        sendApiError("400 Bad Request", "invalid field", apiErrorField);
+        return;
+      }
+      sections |= s.flag;
+    }
+
+    // The job would overwrite it when it completes
+    if ((sections & API_SECTION_CALIBRATION) && calibrationRunning()) {
+      sendApiError("409 Conflict", "calibration running");
+      return;
+    }
+
+    commitConfig(cfg, sections);
+    captureConfig(cfg);
+  }
+
+  // GET, and the applied result of a PUT
+  apiDoc.clear();
+  for (const ApiSection &s : apiSections) {
+    if (allSections) {
+      s.write(apiDoc.createNestedObject(s.key), cfg);
+    } else if (&s == section) {
+      s.write(apiDoc.to<JsonObject>(), cfg);
+    }
+  }
+  sendApiDocument("200 OK");
+}
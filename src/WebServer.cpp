@@ -9,6 +9,15 @@
 #include "NeoPixelControl.h"
 #include "OLED.h"
 #include "NetworkOSC.h"
+#include "i2cPolling.h"
+#include "LatencyStats.h"
+#include "Metrics.h"
+#include "ResponseBuffer.h"
+#include "FormParser.h"
+#include "WebAssets.h"
+#include "WebApi.h"
+#include "Telemetry.h"
+#include "Profiler.h"
 
 using namespace qindesign::network;
 
@@ -17,22 +26,370 @@ using namespace qindesign::network;
 // GLOBAL NETWORK OBJECTS
 //================================
 EthernetServer server(80);
-EthernetClient client;
+
+// Response of the request being handled, page handlers print into this
+ResponseBuffer client;
+
+//================================
+// CONNECTION STATE
+//================================
+// Each connection moves READ_HEADERS -> READ_BODY -> SEND -> IDLE, one step
+// at a time across loop() passes, so a slow browser never holds up the
+// faders. Requests are parsed in place in a fixed buffer. A telemetry
+// stream goes SEND -> STREAM and stays there until the browser leaves.
+
+enum WebConnectionState : uint8_t {
+  WEB_IDLE,
+  WEB_READ_HEADERS,
+  WEB_READ_BODY,
+  WEB_SEND,
+  WEB_STREAM
+};
+
+struct WebConnection {
+  EthernetClient socket;
+  WebConnectionState state;
+  char request[WEB_REQUEST_MAX + 1];   // Request line, headers and body
+  size_t requestLength;
+  size_t headerLength;                 // Up to and including the blank line
+  size_t contentLength;
+  uint8_t *response;                   // This connection's slice of webResponsePool
+  size_t responseLength;
+  const uint8_t *body;                 // Sent from flash after the response (static assets)
+  size_t bodyLength;
+  size_t responseSent;                 // Counts the response, then the body
+  unsigned long lastActivity;
+  bool streaming;                      // Keep open for telemetry after the headers
+  uint32_t streamIntervalUs;
+  uint32_t lastFrameMicros;
+};
+
+static WebConnection webConnections[WEB_MAX_CLIENTS];
+DMAMEM static uint8_t webResponsePool[WEB_MAX_CLIENTS][WEB_RESPONSE_MAX];
+
+// Per-request scratch, handlers allocate here instead of on the heap
+DMAMEM static uint8_t webArenaBuffer[WEB_ARENA_SIZE];
+static Arena webArena;
+
+// Set while a handler runs
+static WebConnection *webActiveConnection = nullptr;
+static int webNextConnection = 0;
+
+// Query string and body fields of the request being handled
+static FormData webForm;
+
+// Raw body of the request being handled (JSON for /api/v1)
+static char *webBody = nullptr;
+static size_t webBodyLength = 0;
+
+static void routeWebRequest(const char *method, const char *path, const FormData &form);
 
 //================================
 // SERVER MANAGEMENT
 //================================
 
 void startWebServer() {
+  for (int i = 0; i < WEB_MAX_CLIENTS; i++) {
+    webConnections[i].state = WEB_IDLE;
+    webConnections[i].response = webResponsePool[i];
+  }
+  arenaInit(webArena, "web", webArenaBuffer, sizeof(webArenaBuffer));
   server.begin();
   debugPrint("Web server started at http://");
   debugPrint(ipToString(Ethernet.localIP()).c_str());
 }
 
+Arena &webRequestArena() {
+  return webArena;
+}
+
+static void closeWebConnection(WebConnection &conn) {
+  conn.socket.close();
+  conn.state = WEB_IDLE;
+}
+
+static void acceptWebClient() {
+  EthernetClient incoming = server.accept();
+  if (!incoming) return;
+
+  for (WebConnection &conn : webConnections) {
+    if (conn.state != WEB_IDLE) continue;
+    conn.socket = incoming;
+    conn.state = WEB_READ_HEADERS;
+    conn.requestLength = 0;
+    conn.headerLength = 0;
+    conn.contentLength = 0;
+    conn.body = nullptr;
+    conn.bodyLength = 0;
+    conn.streaming = false;
+    conn.lastActivity = millis();
+    debugPrint("New client connected");
+    return;
+  }
+
+  // All slots busy, the browser will retry
+  incoming.close();
+  debugPrint("Web client refused, all connections busy");
+}
+
+// Value of a header (after the colon and spaces), nullptr if absent
+static const char *findHeader(const char *headers, size_t length, const char *name) {
+  size_t nameLength = strlen(name);
+
+  for (size_t i = 0; i + nameLength + 3 <= length; i++) {
+    if (headers[i] == '\r' && headers[i + 1] == '\n' &&
+        strncasecmp(headers + i + 2, name, nameLength) == 0 &&
+        headers[i + 2 + nameLength] == ':') {
+      const char *value = headers + i + 3 + nameLength;
+      while (*value == ' ') value++;
+      return value;
+    }
+  }
+  return nullptr;
+}
+
+// Content-Length from the header block, 0 if absent
+static size_t parseContentLength(const char *headers, size_t length) {
+  const char *value = findHeader(headers, length, "Content-Length");
+  return value ? strtoul(value, nullptr, 10) : 0;
+}
+
+// Build the response for a fully received request. The request line is
+// split and the form data decoded in place, handlers get slices of it.
+static void dispatchWebConnection(WebConnection &conn) {
+  PROFILE_ZONE("web_request");
+  char *request = conn.request;
+  request[conn.requestLength] = '\0';
+
+  const char *contentType = findHeader(request, conn.headerLength, "Content-Type");
+  bool urlencodedBody = contentType != nullptr &&
+                        strncasecmp(contentType, "application/x-www-form-urlencoded", 33) == 0;
+
+  formClear(webForm);
+  arenaReset(webArena);
+
+  // "METHOD /path?query HTTP/1.1"
+  char *method = request;
+  char *path = strchr(request, ' ');
+  char *lineEnd = path ? strpbrk(path + 1, " \r") : nullptr;
+
+  client.attach(conn.response, WEB_RESPONSE_MAX);
+  webActiveConnection = &conn;
+
+  if (path == nullptr || lineEnd == nullptr) {
+    send404Response();   // Malformed request
+  } else {
+    *path++ = '\0';
+    char *query = (char *)memchr(path, '?', lineEnd - path);
+    if (query) {
+      *query++ = '\0';
+      formParse(webForm, query, lineEnd - query);
+    } else {
+      *lineEnd = '\0';
+    }
+
+    webBody = request + conn.headerLength;
+    webBodyLength = conn.requestLength - conn.headerLength;
+    if (webBodyLength > conn.contentLength) webBodyLength = conn.contentLength;
+    webBody[webBodyLength] = '\0';
+
+    if (urlencodedBody) {
+      formParse(webForm, webBody, webBodyLength);
+    }
+    if (webForm.truncated) {
+      debugPrintf("Web form has more than %d fields, rest ignored\n", FORM_MAX_FIELDS);
+    }
+
+    routeWebRequest(method, path, webForm);
+  }
+
+  webActiveConnection = nullptr;
+
+  // A cut-off page would look like a valid one, replace it with an error
+  if (client.overflowed()) {
+    debugPrintf("Web response for %s over %d bytes, sending 500\n", path ? path : "?", WEB_RESPONSE_MAX);
+    conn.streaming = false;
+    conn.body = nullptr;
+    conn.bodyLength = 0;
+    client.attach(conn.response, WEB_RESPONSE_MAX);
+    sendErrorResponse("Response too large", "500 Internal Server Error");
+  }
+  conn.responseLength = client.size();
+  conn.responseSent = 0;
+  conn.state = WEB_SEND;
+}
+
+// Answer a request that cannot be read in full, without waiting for the rest
+static void rejectWebRequest(WebConnection &conn, const char *status, const char *message) {
+  debugPrintf("Web request rejected: %s\n", message);
+  client.attach(conn.response, WEB_RESPONSE_MAX);
+  sendErrorResponse(message, status);
+  conn.responseLength = client.size();
+  conn.responseSent = 0;
+  conn.state = WEB_SEND;
+}
+
+// Read whatever has arrived, true once the whole request is in
+static bool readWebRequest(WebConnection &conn) {
+  int available = conn.socket.available();
+  if (available > 0) {
+    size_t room = WEB_REQUEST_MAX - conn.requestLength;
+    if ((size_t)available > room) available = room;
+    if (available == 0) {
+      rejectWebRequest(conn, "413 Content Too Large", "Request too large");
+      return false;
+    }
+
+    int n = conn.socket.read((uint8_t *)conn.request + conn.requestLength, available);
+    if (n > 0) {
+      size_t searchFrom = conn.requestLength >= 3 ? conn.requestLength - 3 : 0;
+      conn.requestLength += n;
+      conn.lastActivity = millis();
+
+      // Look for the blank line only in the new bytes
+      if (conn.state == WEB_READ_HEADERS) {
+        for (size_t i = searchFrom; i + 4 <= conn.requestLength; i++) {
+          if (memcmp(conn.request + i, "\r\n\r\n", 4) == 0) {
+            conn.headerLength = i + 4;
+            conn.contentLength = parseContentLength(conn.request, i + 2);
+            conn.state = WEB_READ_BODY;
+            break;
+          }
+        }
+
+        // Full buffer and still no blank line, the headers can never fit
+        if (conn.state == WEB_READ_HEADERS && conn.requestLength >= WEB_REQUEST_MAX) {
+          rejectWebRequest(conn, "413 Content Too Large", "Request headers too large");
+          return false;
+        }
+      }
+
+      // Declared body will not fit, no point reading it
+      if (conn.state == WEB_READ_BODY && conn.contentLength > WEB_REQUEST_MAX - conn.headerLength) {
+        rejectWebRequest(conn, "413 Content Too Large", "Request body too large");
+        return false;
+      }
+    }
+  }
+
+  return conn.state == WEB_READ_BODY &&
+         conn.requestLength >= conn.headerLength + conn.contentLength;
+}
+
+// Send as much of the response as the socket takes without waiting
+static void sendWebResponse(WebConnection &conn) {
+  size_t total = conn.responseLength + conn.bodyLength;
+
+  while (conn.responseSent < total) {
+    int room = conn.socket.availableForWrite();
+    if (room <= 0) return;
+
+    const uint8_t *data;
+    size_t remaining;
+    if (conn.responseSent < conn.responseLength) {
+      data = conn.response + conn.responseSent;
+      remaining = conn.responseLength - conn.responseSent;
+    } else {
+      size_t offset = conn.responseSent - conn.responseLength;
+      data = conn.body + offset;
+      remaining = conn.bodyLength - offset;
+    }
+
+    size_t chunk = remaining < (size_t)room ? remaining : (size_t)room;
+    size_t written = conn.socket.write(data, chunk);
+    if (written == 0) return;
+    conn.responseSent += written;
+    conn.lastActivity = millis();
+  }
+
+  if (conn.streaming) {
+    // Headers or a frame are out, wait for the next frame
+    conn.state = WEB_STREAM;
+    conn.responseLength = 0;
+    conn.responseSent = 0;
+    conn.bodyLength = 0;
+    return;
+  }
+
+  conn.socket.flush();
+  closeWebConnection(conn);
+  debugPrint("Client disconnected");
+}
+
+// Build and send a frame when one is due. A frame only starts when the
+// socket has room for all of it, otherwise it is skipped, so a browser
+// that reads slowly loses frames instead of stalling the loop. One that
+// stops reading altogether hits WEB_CLIENT_TIMEOUT_MS.
+static void serviceTelemetryStream(WebConnection &conn) {
+  if (conn.responseSent < conn.responseLength) {
+    sendWebResponse(conn);   // Rest of a frame the socket only took part of
+    return;
+  }
+
+  uint32_t now = micros();
+  if (now - conn.lastFrameMicros < conn.streamIntervalUs) return;
+  conn.lastFrameMicros = now;
+
+  if (conn.socket.availableForWrite() < TELEMETRY_FRAME_MAX) {
+    netMetrics.telemetryDropped++;
+    return;
+  }
+
+  PROFILE_ZONE("telemetry_frame");
+  size_t length = buildTelemetryFrame((char *)conn.response, TELEMETRY_FRAME_MAX);
+  if (length == 0) return;
+  conn.responseLength = length;
+  conn.responseSent = 0;
+  netMetrics.telemetryFrames++;
+  sendWebResponse(conn);
+}
+
+static void serviceWebConnection(WebConnection &conn) {
+  if (conn.state == WEB_IDLE || &conn == webActiveConnection) return;
+
+  if (!conn.socket.connected()) {
+    closeWebConnection(conn);
+    return;
+  }
+  if (millis() - conn.lastActivity > WEB_CLIENT_TIMEOUT_MS) {
+    debugPrint("Web client timed out");
+    closeWebConnection(conn);
+    return;
+  }
+
+  switch (conn.state) {
+    case WEB_READ_HEADERS:
+    case WEB_READ_BODY:
+      if (readWebRequest(conn)) {
+        dispatchWebConnection(conn);
+      }
+      break;
+
+    case WEB_SEND:
+      sendWebResponse(conn);
+      break;
+
+    case WEB_STREAM:
+      serviceTelemetryStream(conn);
+      break;
+
+    default:
+      break;
+  }
+}
+
+// Called every loop() pass, does at most WEB_POLL_BUDGET_US of socket work
+// (a page being rendered finishes even if it runs over)
 void pollWebServer() {
-  client = server.available();
-  if (client) {
-    handleWebServer();
+  unsigned long start = micros();
+
+  acceptWebClient();
+
+  for (int n = 0; n < WEB_MAX_CLIENTS; n++) {
+    if (micros() - start >= WEB_POLL_BUDGET_US) break;
+    WebConnection &conn = webConnections[webNextConnection];
+    webNextConnection = (webNextConnection + 1) % WEB_MAX_CLIENTS;
+    serviceWebConnection(conn);
   }
 }
 
@@ -60,241 +417,183 @@ int constrainParam(int value, int minVal, int maxVal, int defaultVal) {
 }
 
 
-void sendErrorResponse(const char* errorMsg) {
-  client.println("HTTP/1.1 400 Bad Request");
+//================================
+// MESSAGE PAGES
+//================================
+// Error and confirmation pages are a card styled by /style.css, so only
+// the status, title and message are built here.
+
+static void printHtmlEscaped(const char *text) {
+  for (const char *c = text; *c; c++) {
+    switch (*c) {
+      case '<':  client.print("&lt;");   break;
+      case '>':  client.print("&gt;");   break;
+      case '&':  client.print("&amp;");  break;
+      case '\'': client.print("&#39;");  break;
+      case '"':  client.print("&quot;"); break;
+      default:   client.write(*c);       break;
+    }
+  }
+}
+
+// kind is the card's style: "error", "success" or "notice"
+static void sendMessagePage(const char *status, const char *kind, const char *title,
+                            const char *message, const char *backPath) {
+  client.printf("HTTP/1.1 %s\r\n", status);
   client.println("Content-Type: text/html");
+  client.println("Cache-Control: no-store");
   client.println("Connection: close");
   client.println();
-  client.println("<html><head>");
+  client.println("<!DOCTYPE html><html><head>");
   client.println("<meta name='viewport' content='width=device-width, initial-scale=1'>");
-  client.println("<style>");
-  client.println("body { font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif; margin: 0; padding: 20px; background: #f5f5f5; }");
-  client.println(".error-container { background: white; border-radius: 8px; padding: 30px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); max-width: 500px; margin: 50px auto; }");
-  client.println("h1 { color: #d32f2f; margin-top: 0; }");
-  client.println("p { color: #666; line-height: 1.6; }");
-  client.println("a { color: #1976d2; text-decoration: none; font-weight: 500; }");
-  client.println("a:hover { text-decoration: underline; }");
-  client.println("</style></head><body>");
-  client.println("<div class='error-container'>");
-  client.println("<h1>Error</h1>");
-  client.printf("<p>%s</p>", errorMsg);
-  client.println("<p><a href='/'>Return to settings</a></p>");
-  client.println("</div></body></html>");
+  client.println("<link rel='stylesheet' href='/style.css'>");
+  client.printf("</head><body><div class='card message %s'><h1>", kind);
+  printHtmlEscaped(title);
+  client.print("</h1><p>");
+  printHtmlEscaped(message);
+  client.printf("</p><p><a href='%s'>Return to settings</a></p></div></body></html>\r\n", backPath);
+}
+
+void sendErrorResponse(const char* errorMsg, const char *status) {
+  sendMessagePage(status, "error", "Error", errorMsg, "/");
 }
 
 //================================
-// MAIN REQUEST HANDLER
+// STATIC ASSETS
 //================================
 
-void handleWebServer() {
-  if (client) {
-    debugPrint("New client connected");
-    
-    // First, read the request line and headers
-    String request = "";
-    String requestBody = "";
-    unsigned long timeout = millis() + 1000; // 1 second timeout
-    bool headersDone = false;
-    int contentLength = 0;
-    
-    // Read headers
-    while (client.connected() && millis() < timeout) {
-      if (client.available()) {
-        char c = client.read();
-        request += c;
-        
-        // Check for Content-Length header
-        if (!headersDone && request.indexOf("Content-Length: ") > 0 && request.indexOf("\r\n", request.indexOf("Content-Length: ")) > 0) {
-          int start = request.indexOf("Content-Length: ") + 16;
-          int end = request.indexOf("\r\n", start);
-          String contentLengthStr = request.substring(start, end);
-          contentLength = contentLengthStr.toInt();
-
-          if (request.startsWith("POST") && contentLength > 0) {
-            debugPrintf("Content-Length: %d\n", contentLength);
-          }
-        }
-        
-        // Check for end of headers
-        if (!headersDone && request.endsWith("\r\n\r\n")) {
-          headersDone = true;
-          debugPrint("Headers complete, reading body...");
-          
-          // If it's a POST with content, we need to read the body
-          if (request.startsWith("POST") && contentLength > 0) {
-            // Read the rest of the body
-            int bytesRead = 0;
-            timeout = millis() + 1000; // Reset timeout for body
-            
-            while (bytesRead < contentLength && client.connected() && millis() < timeout) {
-              if (client.available()) {
-                char c = client.read();
-                requestBody += c;
-                bytesRead++;
-              }
-            }
-            
-            debugPrintf("Request body (%d bytes): %s\n", requestBody.length(), requestBody.c_str());
-          }
-          
-          // Once headers and body are read, we can break the loop
-          break;
-        }
-      }
+// Header of the request being handled, nullptr if absent
+static const char *webRequestHeader(const char *name) {
+  if (webActiveConnection == nullptr) return nullptr;
+  return findHeader(webActiveConnection->request, webActiveConnection->headerLength, name);
+}
+
+// Gzipped asset straight from flash, only the headers go through the
+// response buffer. A matching If-None-Match gets an empty 304.
+static void sendWebAsset(const WebAsset &asset, bool headOnly) {
+  const char *ifNoneMatch = webRequestHeader("If-None-Match");
+  size_t etagLength = strlen(asset.etag);
+  if (ifNoneMatch && strncmp(ifNoneMatch, asset.etag, etagLength) == 0) {
+    client.println("HTTP/1.1 304 Not Modified");
+    client.printf("ETag: %s\r\n", asset.etag);
+    client.printf("Cache-Control: %s\r\n", asset.cacheControl);
+    client.println("Connection: close");
+    client.println();
+    return;
+  }
+
+  client.println("HTTP/1.1 200 OK");
+  client.printf("Content-Type: %s\r\n", asset.contentType);
+  client.println("Content-Encoding: gzip");
+  client.printf("Content-Length: %lu\r\n", (unsigned long)asset.size);
+  client.printf("ETag: %s\r\n", asset.etag);
+  client.printf("Cache-Control: %s\r\n", asset.cacheControl);
+  client.println("Vary: Accept-Encoding");
+  client.println("Connection: close");
+  client.println();
+
+  if (!headOnly) {
+    webActiveConnection->body = asset.data;
+    webActiveConnection->bodyLength = asset.size;
+  }
+}
+
+//================================
+// REQUEST ROUTING
+//================================
+// Runs one complete request. The handler prints its response into the
+// connection's ResponseBuffer, it is sent later by pollWebServer().
+
+typedef void (*WebHandler)(const FormData &form);
+
+struct WebRoute {
+  const char *method;    // nullptr answers any method
+  const char *path;      // Exact match, query string already stripped
+  WebHandler handler;
+};
+
+static void handleEepromDump(const FormData &) {
+  dumpEepromConfig();
+  sendRedirect();
+}
+
+// Profile zones as text, same lines as the PROFILE serial command
+static void handleProfile(const FormData &) {
+  client.println("HTTP/1.1 200 OK");
+  client.println("Content-Type: text/plain");
+  client.println("Cache-Control: no-store");
+  client.println("Connection: close");
+  client.println();
+  printProfile(client);
+}
+
+static void handleProfileReset(const FormData &form) {
+  resetProfiler();
+  handleProfile(form);
+}
+
+static void handleMetricsReset(const FormData &) {
+  resetMetrics();
+  resetLatencyStats();
+  handleMetrics();
+}
+
+// Each settings form posts to its own path. The pages themselves are
+// static assets, looked up when no route matches.
+static const WebRoute webRoutes[] = {
+  { nullptr, "/state.json",       [](const FormData &) { handleStateJson(); } },
+  { "GET",   "/telemetry",        handleTelemetryStream },
+  { nullptr, "/metrics",          [](const FormData &) { handleMetrics(); } },
+  { "POST",  "/metrics/reset",    handleMetricsReset },
+  { "GET",   "/profile",          handleProfile },
+  { "POST",  "/profile/reset",    handleProfileReset },
+  { "POST",  "/save/network",     handleNetworkSettings },
+  { "POST",  "/save/osc",         handleOSCSettings },
+  { "POST",  "/save/fader",       handleFaderSettings },
+  { "POST",  "/save/calibration", handleCalibrationSettings },
+  { "POST",  "/save/touch",       handleTouchSettings },
+  { "POST",  "/calibrate",        [](const FormData &) { handleRunCalibration(); } },
+  { "POST",  "/debug",            handleDebugToggle },
+  { "POST",  "/dump",             handleEepromDump },
+  { "POST",  "/reset_defaults",   [](const FormData &) { handleResetDefaults(); } },
+  { "POST",  "/reset_network",    [](const FormData &) { handleNetworkReset(); } },
+};
+
+static void routeWebRequest(const char *method, const char *path, const FormData &form) {
+  debugPrintf("Request: %s %s (%d fields)\n", method, path, form.count);
+
+  if (strncmp(path, "/api/v1/", 8) == 0) {
+    handleApiRequest(method, path + 7, webBody, webBodyLength);
+    return;
+  }
+
+  bool pathFound = false;
+  for (const WebRoute &route : webRoutes) {
+    if (strcmp(route.path, path) != 0) continue;
+    pathFound = true;
+    if (route.method == nullptr || strcmp(route.method, method) == 0) {
+      route.handler(form);
+      return;
     }
-    
-    // Now handle the request with both headers and body
-    // Extract request method and path
-    int methodEndPos = request.indexOf(' ');
-    int pathEndPos = request.indexOf(' ', methodEndPos + 1);
-    
-    if (methodEndPos > 0 && pathEndPos > methodEndPos) {
-      String method = request.substring(0, methodEndPos);          // GET, POST, etc.
-      String path = request.substring(methodEndPos + 1, pathEndPos); // /save, /debug, etc.
-      
-      debugPrintf("Request: %s %s\n", method.c_str(), path.c_str());
-      
-      // Determine which type of request to handle
-      char requestType = '\0';
-      
-      // UPDATED ROUTING LOGIC
-      if (path.startsWith("/save")) {
-        debugPrint("Processing /save request");
-        debugPrintf("Request parameters: %s\n", request.c_str());
-        
-        // Check for specific parameter combinations to determine request type
-        // Use more specific patterns to avoid false matches (e.g., "ip=" inside "osc_sendip=")
-        bool hasNetworkFields = (request.indexOf("&ip=") >= 0 || request.indexOf("?ip=") >= 0 || 
-                                request.indexOf("dhcp=") >= 0 || 
-                                request.indexOf("gw=") >= 0 || request.indexOf("sn=") >= 0);
-        bool hasOSCFields = (request.indexOf("osc_sendip=") >= 0 || request.indexOf("osc_sendport=") >= 0 || 
-                            request.indexOf("osc_receiveport=") >= 0);
-        
-        // Debug output to see what's being detected
-        debugPrintf("hasNetworkFields: %s\n", hasNetworkFields ? "true" : "false");
-        debugPrintf("hasOSCFields: %s\n", hasOSCFields ? "true" : "false");
-        debugPrintf("osc_sendip check: %d\n", request.indexOf("osc_sendip="));
-        debugPrintf("osc_sendport check: %d\n", request.indexOf("osc_sendport="));
-        debugPrintf("osc_receiveport check: %d\n", request.indexOf("osc_receiveport="));
-        
-        if (hasNetworkFields && !hasOSCFields) {
-          requestType = 'N'; // Network settings only
-          debugPrint("Determined: Network settings");
-        } else if (hasOSCFields && !hasNetworkFields) {
-          requestType = 'O'; // OSC settings only  
-          debugPrint("Determined: OSC settings");
-        } else if (hasOSCFields && hasNetworkFields) {
-          // This should not happen with the new separated forms, but handle it
-          debugPrint("WARNING: Both network and OSC fields detected - treating as OSC");
-          requestType = 'O'; // Default to OSC to be safe
-        } else if (request.indexOf("calib_pwm=") >= 0) {
-          requestType = 'C'; // Calibration settings
-          debugPrint("Determined: Calibration settings");
-        } else if (request.indexOf("pidKp=") >= 0) {
-          requestType = 'P'; // PID settings
-          debugPrint("Determined: PID settings");
-        } else if (request.indexOf("touchThreshold=") >= 0) {
-          requestType = 'T'; // Touch settings
-          debugPrint("Determined: Touch settings");
-        } else if (request.indexOf("minPwm=") >= 0 || request.indexOf("baseBrightness=") >= 0) {
-          requestType = 'F'; // Fader settings (including brightness)
-          debugPrint("Determined: Fader settings");
-        } else {
-          debugPrint("ERROR: Could not determine request type");
-          debugPrintf("Request: %s\n", request.c_str());
-        }
-      } else if (path == "/calibrate" && method == "POST") {
-        requestType = 'R'; // Run calibration
-      } else if (path == "/debug" && method == "POST") {
-        requestType = 'D'; // Debug mode toggle
-      } else if (path == "/dump" && method == "POST") {
-        requestType = 'E'; // EEPROM dump
-      } else if (path == "/reset_defaults" && method == "POST") {
-        requestType = 'X'; // Reset to defaults
-      } else if (path == "/reset_network" && method == "POST") {
-        requestType = 'Z'; // Reset network settings
-      } else if (path == "/stats") {  
-        requestType = 'S'; // Stats page
-      } else if (path == "/fader_settings") {
-        requestType = 'G'; // Fader settings page
-      } else if (path == "/osc_settings") {
-        requestType = 'A'; // OSC settings page
-      } else if (path == "/") {
-        requestType = 'H'; // Home/Root page
-      }
-      
-      // Handle the request based on its type
-      switch (requestType) {
-        case 'N': // Network settings
-          handleNetworkSettings(request);
-          break;
-          
-        case 'O': // OSC settings only
-          handleOSCSettings(request);
-          break;
-          
-        case 'C': // Calibration settings
-          handleCalibrationSettings(request);
-          break;
-          
-        case 'R': // Run calibration
-          handleRunCalibration();
-          break;
-          
-        case 'D': // Debug mode toggle
-          handleDebugToggle(requestBody); // Pass the request body instead of full request
-          break;
-          
-        case 'H': // Home/Root page
-          handleRoot();
-          break;
-
-        case 'E': // EEPROM dump
-          dumpEepromConfig();
-          sendRedirect();
-          break;
-        
-        case 'F': // Fader settings
-          handleFaderSettings(request);
-          break;
-
-        case 'T': // Touch settings
-          handleTouchSettings(request);
-          break;
-
-        case 'X': // Reset to defaults
-          handleResetDefaults();
-          break;
-
-        case 'Z': // Reset network settings
-          handleNetworkReset();
-          break;
-          
-        case 'S': // Stats page
-          handleStatsPage();
-          break;
-          
-        case 'G': // Fader settings page
-          handleFaderSettingsPage();
-          break;
-          
-        case 'A': // OSC settings page
-          handleOSCSettingsPage();
-          break;
-          
-        default: // 404 or unrecognized request
-          debugPrint("Unrecognized request, sending 404");
-          send404Response();
-          break;
-      }
-    } else {
-      // Malformed request
-      send404Response();
+  }
+
+  bool isGet = strcmp(method, "GET") == 0;
+  bool isHead = strcmp(method, "HEAD") == 0;
+  for (size_t i = 0; i < webAssetCount; i++) {
+    if (strcmp(webAssets[i].path, path) != 0) continue;
+    if (isGet || isHead) {
+      sendWebAsset(webAssets[i], isHead);
+      return;
     }
-    
-    delay(10); // Give the web browser time to receive the data
-    client.stop();
-    debugPrint("Client disconnected");
+    pathFound = true;
+  }
+
+  if (pathFound) {
+    debugPrintf("Method %s not allowed for %s\n", method, path);
+    sendMethodNotAllowed();
+  } else {
+    debugPrint("Unrecognized request, sending 404");
+    send404Response();
   }
 }
 
@@ -302,36 +601,168 @@ void handleWebServer() {
 // INDIVIDUAL REQUEST HANDLERS
 //================================
 
+// Counters and handler timings as plain "name value" lines for scripts
+void handleMetrics() {
+  client.println("HTTP/1.1 200 OK");
+  client.println("Content-Type: text/plain");
+  client.println("Cache-Control: no-store");
+  client.println("Connection: close");
+  client.println();
+  printMetrics(client);
+}
+
+// Live values for the static pages, app.js fills the forms and tables
+// from this. Form values are keyed by the input names.
+void handleStateJson() {
+  client.println("HTTP/1.1 200 OK");
+  client.println("Content-Type: application/json");
+  client.println("Cache-Control: no-store");
+  client.println("Connection: close");
+  client.println();
+
+  client.printf("{\"localIP\":\"%s\",", ipToString(Ethernet.localIP()).c_str());
+  client.printf("\"sendTo\":\"%s:%u\",", ipToString(netConfig.sendToIP).c_str(), netConfig.sendPort);
+  client.printf("\"receiveOn\":\"%s:%u\",", ipToString(Ethernet.localIP()).c_str(), netConfig.receivePort);
+  client.printf("\"destinationCount\":%d,", OSC_MAX_DESTINATIONS);
+
+  client.print("\"form\":{");
+  client.printf("\"dhcp\":%d,\"ip\":\"%s\",", netConfig.useDHCP, ipToString(netConfig.staticIP).c_str());
+  client.printf("\"gw\":\"%s\",", ipToString(netConfig.gateway).c_str());
+  client.printf("\"sn\":\"%s\",", ipToString(netConfig.subnet).c_str());
+  client.printf("\"debug\":%d,", debugMode);
+  client.printf("\"osc_sendip\":\"%s\",", ipToString(netConfig.sendToIP).c_str());
+  client.printf("\"osc_sendport\":%u,\"osc_receiveport\":%u,\"osc_tcp\":%d,",
+                netConfig.sendPort, netConfig.receivePort, netConfig.sendTcp);
+  for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+    const OscDestination &dest = oscDestinations[d];
+    client.printf("\"dest%d_en\":%d,\"dest%d_ip\":\"%s\",\"dest%d_port\":%u,\"dest%d_bc\":%d,\"dest%d_tcp\":%d,",
+                  d, dest.enabled, d, ipToString(dest.ip).c_str(), d, dest.port, d, dest.broadcast, d, dest.tcp);
+  }
+  client.printf("\"minPwm\":%u,\"defaultPwm\":%u,\"targetTolerance\":%u,\"sendTolerance\":%u,",
+                Fconfig.minPwm, Fconfig.defaultPwm, Fconfig.targetTolerance, Fconfig.sendTolerance);
+  client.printf("\"baseBrightness\":%u,\"touchedBrightness\":%u,\"calib_pwm\":%u,",
+                Fconfig.baseBrightness, Fconfig.touchedBrightness, Fconfig.calibratePwm);
+  client.printf("\"autoCalMode\":%d,\"touchThreshold\":%u,\"releaseThreshold\":%u},",
+                autoCalibrationMode, touchThreshold, releaseThreshold);
+
+  // Main console first, then the enabled extra destinations
+  client.print("\"destinationStats\":[");
+  bool first = true;
+  for (int d = 0; d <= OSC_MAX_DESTINATIONS; d++) {
+    if (d > 0 && !oscDestinations[d - 1].enabled) continue;
+    const OscDestinationStats &stats = getOscDestinationStats(d);
+    IPString name = (d == 0) ? ipToString(netConfig.sendToIP)
+                  : (oscDestinations[d - 1].broadcast ? IPString("broadcast") : ipToString(oscDestinations[d - 1].ip));
+    client.printf("%s{\"name\":\"%s\",\"packets\":%lu,\"bytes\":%lu,\"errors\":%lu}", first ? "" : ",",
+                  name.c_str(), (unsigned long)stats.packets, (unsigned long)stats.bytes, (unsigned long)stats.errors);
+    first = false;
+  }
+  client.print("],");
+
+  client.print("\"faders\":[");
+  for (int i = 0; i < NUM_FADERS; i++) {
+    Fader &f = faders[i];
+    client.printf("%s{\"current\":%d,\"min\":%d,\"max\":%d,\"osc\":%d}", i ? "," : "",
+                  analogRead(f.analogPin), f.minVal, f.maxVal, readFadertoOSC(f));
+  }
+  client.print("],");
+
+  // OSC output counters as label/value rows
+  const OscOutputStats &oscStats = getOscOutputStats();
+  const OscLimiterStats &limiterStats = getOscLimiterStats();
+  const EncoderStats &encStats = getEncoderStats();
+  client.print("\"oscOutput\":[");
+  client.printf("[\"Messages sent\",%lu],", (unsigned long)oscStats.messages);
+  client.printf("[\"UDP packets sent\",%lu],", (unsigned long)oscStats.packets);
+  client.printf("[\"Packets saved by bundling\",%lu],", (unsigned long)(oscStats.messages - oscStats.packets));
+  client.printf("[\"Fader values sent\",%lu],", (unsigned long)limiterStats.sent);
+  client.printf("[\"Fader values coalesced\",%lu],", (unsigned long)limiterStats.coalesced);
+  client.printf("[\"Fader values dropped\",%lu],", (unsigned long)limiterStats.dropped);
+  client.printf("[\"Encoder events received\",%lu],", (unsigned long)encStats.events);
+  client.printf("[\"Encoder messages sent\",%lu]],", (unsigned long)encStats.messages);
+
+  // Latency histograms, buckets as [upper limit us, count], limit 0 = overflow
+  const LatencyHistogram *histograms[] = { &oscToMotorLatency, &touchToOscLatency };
+  client.print("\"latency\":[");
+  for (size_t n = 0; n < sizeof(histograms) / sizeof(histograms[0]); n++) {
+    const LatencyHistogram &h = *histograms[n];
+    client.printf("%s{\"name\":\"%s\",\"count\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu,\"p50\":%lu,\"p99\":%lu,\"buckets\":[",
+                  n ? "," : "", h.name, (unsigned long)h.count, (unsigned long)h.minUs,
+                  (unsigned long)latencyAverage(h), (unsigned long)h.maxUs,
+                  (unsigned long)latencyPercentile(h, 50), (unsigned long)latencyPercentile(h, 99));
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+      client.printf("%s[%lu,%lu]", b ? "," : "", (unsigned long)latencyBucketLimit(b), (unsigned long)h.buckets[b]);
+    }
+    client.print("]}");
+  }
+  client.println("]}");
+}
+
 void send404Response() {
-  client.println("HTTP/1.1 404 Not Found");
-  client.println("Content-Type: text/html");
+  sendMessagePage("404 Not Found", "error", "404 Page Not Found",
+                  "The requested resource was not found on this server.", "/");
+}
+
+void sendMethodNotAllowed() {
+  client.println("HTTP/1.1 405 Method Not Allowed");
+  client.println("Content-Type: text/plain");
   client.println("Connection: close");
   client.println();
-  client.println("<html><head>");
-  client.println("<meta name='viewport' content='width=device-width, initial-scale=1'>");
-  client.println("<style>");
-  client.println("body { font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif; margin: 0; padding: 20px; background: #f5f5f5; }");
-  client.println(".error-container { background: white; border-radius: 8px; padding: 30px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); max-width: 500px; margin: 50px auto; text-align: center; }");
-  client.println("h1 { color: #d32f2f; margin-top: 0; font-size: 72px; margin-bottom: 10px; }");
-  client.println("h2 { color: #333; margin-top: 0; }");
-  client.println("p { color: #666; line-height: 1.6; }");
-  client.println("a { color: #1976d2; text-decoration: none; font-weight: 500; }");
-  client.println("a:hover { text-decoration: underline; }");
-  client.println("</style></head><body>");
-  client.println("<div class='error-container'>");
-  client.println("<h1>404</h1>");
-  client.println("<h2>Page Not Found</h2>");
-  client.println("<p>The requested resource was not found on this server.</p>");
-  client.println("<p><a href='/'>Return to home</a></p>");
-  client.println("</div></body></html>");
+  client.println("Method not allowed");
+}
+
+// 400 naming the form field that failed to bind
+static void sendFieldError(const char *key) {
+  char message[64];
+  snprintf(message, sizeof(message), "Invalid value for %s", key);
+  debugPrintf("ERROR: %s\n", message);
+  sendErrorResponse(message);
+}
+
+// Server-Sent Events stream of fader and loop telemetry, ?hz= sets the
+// frame rate. Frames are sent by serviceTelemetryStream() afterwards.
+void handleTelemetryStream(const FormData &form) {
+  int streams = 0;
+  for (const WebConnection &conn : webConnections) {
+    if (conn.streaming) streams++;
+  }
+  if (streams >= TELEMETRY_MAX_STREAMS) {
+    client.println("HTTP/1.1 503 Service Unavailable");
+    client.println("Content-Type: text/plain");
+    client.println("Retry-After: 5");
+    client.println("Connection: close");
+    client.println();
+    client.println("Telemetry stream already in use");
+    return;
+  }
+
+  long hz = TELEMETRY_DEFAULT_HZ;
+  const char *hzText = formGet(form, "hz");
+  if (hzText && (!formParseInt(hzText, hz) || hz < 1 || hz > TELEMETRY_MAX_HZ)) {
+    sendFieldError("hz");
+    return;
+  }
+
+  client.println("HTTP/1.1 200 OK");
+  client.println("Content-Type: text/event-stream");
+  client.println("Cache-Control: no-store");
+  client.println();
+  client.println("retry: 2000");
+  client.println();
+
+  webActiveConnection->streaming = true;
+  webActiveConnection->streamIntervalUs = 1000000 / hz;
+  webActiveConnection->lastFrameMicros = micros();
+  debugPrintf("Telemetry stream started at %ld Hz\n", hz);
 }
 
 
-void handleDebugToggle(String requestBody) {
+void handleDebugToggle(const FormData &form) {
   Serial.println("[Toggle] Received /debug POST request");
-  Serial.printf("[Toggle] Raw body: %s\n", requestBody.c_str());
 
-  debugMode = (requestBody.indexOf("debug=1") != -1);
+  // Hidden "0" comes first, the checkbox adds a "1" when checked
+  const char *debug = formGet(form, "debug");
+  debugMode = (debug != nullptr && strcmp(debug, "1") == 0);
   Serial.printf("[Toggle] Debug mode is now: %d\n", debugMode);
 
     Fconfig.serialDebug = debugMode;
@@ -343,75 +774,44 @@ void handleDebugToggle(String requestBody) {
 }
 
 
-void handleNetworkSettings(String request) {
+void handleNetworkSettings(const FormData &form) {
   debugPrint("Handling network settings...");
-  
-  // FIXED: Proper DHCP checkbox detection
-  bool newDHCP = (request.indexOf("dhcp=on") >= 0 || request.indexOf("dhcp=1") >= 0);
-  
-  // Extract network parameters with validation
-  String ipStr = getParam(request, "ip");
-  String gwStr = getParam(request, "gw");
-  String snStr = getParam(request, "sn");
-  
-  // Validate IP addresses before applying
-  IPAddress newStaticIP = stringToIP(ipStr);
-  IPAddress newGateway = stringToIP(gwStr);
-  IPAddress newSubnet = stringToIP(snStr);
-  
-  // Only update if we have valid values
-  if (ipStr.length() > 0 && isValidIP(newStaticIP)) {
-    netConfig.staticIP = newStaticIP;
-    debugPrintf("Updated Static IP: %s\n", ipToString(netConfig.staticIP).c_str());
-  } else if (ipStr.length() > 0) {
-    debugPrintf("ERROR: Invalid static IP: %s\n", ipStr.c_str());
+
+  NetworkConfig cfg = netConfig;
+  const FormBinding bindings[] = {
+    { "dhcp", FORM_CHECKBOX, &cfg.useDHCP,   0, 0 },
+    { "ip",   FORM_IP,       &cfg.staticIP, 0, 0 },
+    { "gw",   FORM_IP,       &cfg.gateway,  0, 0 },
+    { "sn",   FORM_IP,       &cfg.subnet,   0, 0 },
+  };
+
+  const char *badField = formBind(form, bindings, FORM_BINDING_COUNT(bindings));
+  if (badField) {
+    sendFieldError(badField);
+    return;
+  }
+
+  if (!isValidIP(cfg.staticIP)) {
     sendErrorResponse("Invalid static IP address");
     return;
   }
-  
-  if (gwStr.length() > 0 && isValidIP(newGateway)) {
-    netConfig.gateway = newGateway;
-  } else if (gwStr.length() > 0) {
-    debugPrintf("ERROR: Invalid gateway: %s\n", gwStr.c_str());
+  if (!isValidIP(cfg.gateway)) {
     sendErrorResponse("Invalid gateway address");
     return;
   }
-  
-  if (snStr.length() > 0 && isValidIP(newSubnet)) {
-    netConfig.subnet = newSubnet;
-  } else if (snStr.length() > 0) {
-    debugPrintf("ERROR: Invalid subnet: %s\n", snStr.c_str());
+  if (!isValidIP(cfg.subnet)) {
     sendErrorResponse("Invalid subnet address");
     return;
   }
-  
-  // Update DHCP setting
-  netConfig.useDHCP = newDHCP;
+
+  netConfig = cfg;
+  debugPrintf("Updated Static IP: %s\n", ipToString(netConfig.staticIP).c_str());
   debugPrintf("DHCP setting: %s\n", netConfig.useDHCP ? "ENABLED" : "DISABLED");
   
   
-  // Send success response with improved styling
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/html");
-  client.println("Connection: close");
-  client.println();
-  client.println("<html><head>");
-  client.println("<meta name='viewport' content='width=device-width, initial-scale=1'>");
-  client.println("<style>");
-  client.println("body { font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif; margin: 0; padding: 20px; background: #f5f5f5; }");
-  client.println(".success-container { background: white; border-radius: 8px; padding: 30px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); max-width: 500px; margin: 50px auto; }");
-  client.println("h1 { color: #2e7d32; margin-top: 0; }");
-  client.println("p { color: #666; line-height: 1.6; }");
-  client.println("a { color: #1976d2; text-decoration: none; font-weight: 500; }");
-  client.println("a:hover { text-decoration: underline; }");
-  client.println("</style></head><body>");
-  client.println("<div class='success-container'>");
-  client.println("<h1>Network Settings Saved</h1>");
-  client.println("<p>Network settings have been saved successfully. For changes to take full effect, you may have to restart the device.</p>");
-  client.println("<p><a href='/'>Return to settings</a></p>");
-  client.println("</div></body></html>");
-
-  delay(2000);
+  sendMessagePage("200 OK", "success", "Network Settings Saved",
+                  "Network settings have been saved successfully. For changes to take full effect, "
+                  "you may have to restart the device.", "/");
 
     // Save to EEPROM
   saveNetworkConfig();
@@ -420,147 +820,70 @@ void handleNetworkSettings(String request) {
 
 
 
-void handleOSCSettingsPage() {
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/html");
-  client.println("Connection: close");
-  client.println();
-  
-  client.println("<!DOCTYPE html><html><head><title>OSC Settings</title>");
-  client.println("<meta name='viewport' content='width=device-width, initial-scale=1'>");
-  sendCommonStyles();
-  client.println("</head><body>");
-  
-  sendNavigationHeader("OSC Settings");
-  
-  client.println("<div class='container'>");
-  
-  waitForWriteSpace();
-  
-  client.println("<div class='card'>");
-  client.println("<h2>OSC Settings</h2>");
-  
-  client.println("<form method='get' action='/save'>");
-  
-  client.println("<label>OSC Send IP</label>");
-  client.print("<input type='text' name='osc_sendip' value='");
-  client.print(ipToString(netConfig.sendToIP));
-  client.println("'>");
-  client.println("<p class='help'>IP address of GMA3 console</p>");
-  
-  client.println("<label>OSC Send Port</label>");
-  client.print("<input type='number' name='osc_sendport' value='");
-  client.print(netConfig.sendPort);
-  client.println("'>");
-  
-  client.println("<label>OSC Receive Port</label>");
-  client.print("<input type='number' name='osc_receiveport' value='");
-  client.print(netConfig.receivePort);
-  client.println("'>");
-  
-  client.println("<button type='submit'>Save OSC Settings</button>");
-  client.println("</form>");
-  
-  client.println("<div class='divider'></div>");
-  
-  client.println("<p><strong>Current Status:</strong></p>");
-  client.print("<p>Send to: ");
-  client.print(ipToString(netConfig.sendToIP));
-  client.print(":");
-  client.print(netConfig.sendPort);
-  client.println("</p>");
-  
-  client.print("<p>Receive on: ");
-  client.print(ipToString(Ethernet.localIP()));
-  client.print(":");
-  client.print(netConfig.receivePort);
-  client.println("</p>");
-  
-  client.println("</div>");
-  
-  client.println("</div>");
-  client.println("</body></html>");
-}
-
-void handleCalibrationSettings(String request) {
+void handleCalibrationSettings(const FormData &form) {
   debugPrint("Handling calibration settings...");
   
-  String calibPwmStr = getParam(request, "calib_pwm");
-  
-  if (calibPwmStr.length() > 0) {
-    int calibPwm = calibPwmStr.toInt();
-    
-    // Use constrainParam for validation
-    Fconfig.calibratePwm = constrainParam(calibPwm, 0, 255, Fconfig.calibratePwm);
-    debugPrintf("Calibration PWM saved: %d\n", Fconfig.calibratePwm);
-    
-    // Save to EEPROM
-    saveFaderConfig();
-    
-    // Redirect back to fader settings page
-    client.println("HTTP/1.1 303 See Other");
-    client.println("Location: /fader_settings");
-    client.println("Connection: close");
-    client.println();
-  } else {
+  if (formGet(form, "calib_pwm") == nullptr) {
     sendErrorResponse("Missing calibration PWM parameter");
     return;
   }
-}
 
-void handleFaderSettings(String request) {
-  debugPrint("Handling fader settings...");
-  
-  // Extract parameter strings
-  String minPwmStr = getParam(request, "minPwm");
-  String defaultPwmStr = getParam(request, "defaultPwm");
-  String targetToleranceStr = getParam(request, "targetTolerance");
-  String sendToleranceStr = getParam(request, "sendTolerance");
-  String baseBrightnessStr = getParam(request, "baseBrightness");
-  String touchedBrightnessStr = getParam(request, "touchedBrightness");
-  
-  // Validate and update using constrainParam
-  if (minPwmStr.length() > 0) {
-    int minPwm = minPwmStr.toInt();
-    Fconfig.minPwm = constrainParam(minPwm, 0, 255, Fconfig.minPwm);
-  }
-  
-  if (defaultPwmStr.length() > 0) {
-    int defaultPwm = defaultPwmStr.toInt();
-    Fconfig.defaultPwm = constrainParam(defaultPwm, 0, 255, Fconfig.defaultPwm);
-  }
-  
-  if (targetToleranceStr.length() > 0) {
-    int targetTolerance = targetToleranceStr.toInt();
-    Fconfig.targetTolerance = constrainParam(targetTolerance, 0, 100, Fconfig.targetTolerance);
+  FaderConfig cfg = Fconfig;
+  const FormBinding bindings[] = {
+    { "calib_pwm", FORM_UINT8, &cfg.calibratePwm, 0, 255 },
+  };
+
+  const char *badField = formBind(form, bindings, FORM_BINDING_COUNT(bindings));
+  if (badField) {
+    sendFieldError(badField);
+    return;
   }
+
+  Fconfig = cfg;
+  debugPrintf("Calibration PWM saved: %d\n", Fconfig.calibratePwm);
   
-  if (sendToleranceStr.length() > 0) {
-    int sendTolerance = sendToleranceStr.toInt();
-    Fconfig.sendTolerance = constrainParam(sendTolerance, 0, 100, Fconfig.sendTolerance);
-  }
+  // Save to EEPROM
+  saveFaderConfig();
   
-  if (baseBrightnessStr.length() > 0) {
-    int baseBrightness = baseBrightnessStr.toInt();
-    Fconfig.baseBrightness = constrainParam(baseBrightness, 0, 255, Fconfig.baseBrightness);
-    updateBaseBrightnessPixels();
-    debugPrintf("Base Brightness saved: %d\n", Fconfig.baseBrightness);
-  }
+  // Redirect back to fader settings page
+  client.println("HTTP/1.1 303 See Other");
+  client.println("Location: /fader_settings");
+  client.println("Connection: close");
+  client.println();
+}
+
+void handleFaderSettings(const FormData &form) {
+  debugPrint("Handling fader settings...");
   
-  if (touchedBrightnessStr.length() > 0) {
-    int touchedBrightness = touchedBrightnessStr.toInt();
-    Fconfig.touchedBrightness = constrainParam(touchedBrightness, 0, 255, Fconfig.touchedBrightness);
-    debugPrintf("Touched Brightness saved: %d\n", Fconfig.touchedBrightness);
+  FaderConfig cfg = Fconfig;
+  const FormBinding bindings[] = {
+    { "minPwm",            FORM_UINT8, &cfg.minPwm,            0, 255 },
+    { "defaultPwm",        FORM_UINT8, &cfg.defaultPwm,        0, 255 },
+    { "targetTolerance",   FORM_UINT8, &cfg.targetTolerance,   0, 100 },
+    { "sendTolerance",     FORM_UINT8, &cfg.sendTolerance,     0, 100 },
+    { "baseBrightness",    FORM_UINT8, &cfg.baseBrightness,    0, 255 },
+    { "touchedBrightness", FORM_UINT8, &cfg.touchedBrightness, 0, 255 },
+  };
+
+  const char *badField = formBind(form, bindings, FORM_BINDING_COUNT(bindings));
+  if (badField) {
+    sendFieldError(badField);
+    return;
   }
   
   // Additional logical validation
-  if (Fconfig.minPwm > Fconfig.defaultPwm) {
+  if (cfg.minPwm > cfg.defaultPwm) {
     debugPrint("Warning: Min PWM is greater than Default PWM, swapping values");
-    int temp = Fconfig.minPwm;
-    Fconfig.minPwm = Fconfig.defaultPwm;
-    Fconfig.defaultPwm = temp;
+    uint8_t temp = cfg.minPwm;
+    cfg.minPwm = cfg.defaultPwm;
+    cfg.defaultPwm = temp;
   }
 
+  bool brightnessChanged = cfg.baseBrightness != Fconfig.baseBrightness;
+  Fconfig = cfg;
+  if (brightnessChanged) updateBaseBrightnessPixels();
+  debugPrintf("Brightness saved: base %d, touched %d\n", Fconfig.baseBrightness, Fconfig.touchedBrightness);
+
   // Save to EEPROM
   saveFaderConfig();
   
@@ -571,17 +894,12 @@ void handleFaderSettings(String request) {
   client.println();
 }
 
+// Starts the calibration job, the fader page shows its progress
 void handleRunCalibration() {
-  debugPrint("Running fader calibration...");
-  
-  // Run the calibration process
-  calibrateFaders();
-  saveCalibration();
+  if (!startCalibration()) {
+    debugPrint("Calibration already running");
+  }
 
-  // Reinitialize MPR121 after calibration due to I2C hang risk
-  debugPrint("Reinitializing touch sensor after calibration...");
-  setupTouch();  // Restore I2C communication and config
-  
   // Redirect back to fader settings page
   client.println("HTTP/1.1 303 See Other");
   client.println("Location: /fader_settings");
@@ -589,28 +907,27 @@ void handleRunCalibration() {
   client.println();
 }
 
-void handleTouchSettings(String request) {
+void handleTouchSettings(const FormData &form) {
   debugPrint("Handling touch sensor settings...");
   
-  String autoCalModeStr = getParam(request, "autoCalMode");
-  String touchThresholdStr = getParam(request, "touchThreshold");
-  String releaseThresholdStr = getParam(request, "releaseThreshold");
-  
-  // Validate and update using constrainParam
-  if (autoCalModeStr.length() > 0) {
-    int autoCalMode = autoCalModeStr.toInt();
-    autoCalibrationMode = constrainParam(autoCalMode, 0, 2, autoCalibrationMode);
-  }
-  
-  if (touchThresholdStr.length() > 0) {
-    int threshold = touchThresholdStr.toInt();
-    touchThreshold = constrainParam(threshold, 1, 255, touchThreshold);
-  }
-  
-  if (releaseThresholdStr.length() > 0) {
-    int threshold = releaseThresholdStr.toInt();
-    releaseThreshold = constrainParam(threshold, 1, 255, releaseThreshold);
+  int mode = autoCalibrationMode;
+  uint8_t touch = touchThreshold;
+  uint8_t release = releaseThreshold;
+  const FormBinding bindings[] = {
+    { "autoCalMode",      FORM_INT,   &mode,    0, 2 },
+    { "touchThreshold",   FORM_UINT8, &touch,   1, 255 },
+    { "releaseThreshold", FORM_UINT8, &release, 1, 255 },
+  };
+
+  const char *badField = formBind(form, bindings, FORM_BINDING_COUNT(bindings));
+  if (badField) {
+    sendFieldError(badField);
+    return;
   }
+
+  autoCalibrationMode = mode;
+  touchThreshold = touch;
+  releaseThreshold = release;
   
   // Additional logical validation - ensure release < touch
   if (releaseThreshold >= touchThreshold) {
@@ -622,15 +939,11 @@ void handleTouchSettings(String request) {
     }
   }
   
-  // Apply the settings to the touch sensor
-  setAutoTouchCalibration(autoCalibrationMode);
-  manualTouchCalibration();
-  
   // Save to EEPROM
   saveTouchConfig();
   
-  // Reset MPR121
-  setupTouch();
+  // Reset MPR121 with the new settings from the touch task, not in the request
+  requestTouchSetup();
   
   // Redirect back to fader settings page
   client.println("HTTP/1.1 303 See Other");
@@ -645,79 +958,71 @@ void handleResetDefaults() {
   sendRedirect();
 }
 
-void handleOSCSettings(String request) {
+void handleOSCSettings(const FormData &form) {
   debugPrint("Handling OSC settings only...");
   
-  // Extract OSC parameters
-  String sendIPStr = getParam(request, "osc_sendip");
-  String sendPortStr = getParam(request, "osc_sendport");
-  String receivePortStr = getParam(request, "osc_receiveport");
-  
-  // Validate and update OSC Send IP
-  if (sendIPStr.length() > 0) {
-    IPAddress newSendIP = stringToIP(sendIPStr);
-    if (isValidIP(newSendIP)) {
-      netConfig.sendToIP = newSendIP;
-      debugPrintf("Updated OSC Send IP: %s\n", ipToString(netConfig.sendToIP).c_str());
-    } else {
-      debugPrintf("ERROR: Invalid OSC send IP: %s\n", sendIPStr.c_str());
-      sendErrorResponse("Invalid OSC send IP address");
-      return;
-    }
+  NetworkConfig cfg = netConfig;
+  const FormBinding bindings[] = {
+    { "osc_sendip",      FORM_IP,       &cfg.sendToIP,    0, 0 },
+    { "osc_sendport",    FORM_UINT16,   &cfg.sendPort,    1, 65535 },
+    { "osc_receiveport", FORM_UINT16,   &cfg.receivePort, 1, 65535 },
+    { "osc_tcp",         FORM_CHECKBOX, &cfg.sendTcp,     0, 0 },
+  };
+
+  const char *badField = formBind(form, bindings, FORM_BINDING_COUNT(bindings));
+  if (badField) {
+    sendFieldError(badField);
+    return;
   }
-  
-  // Validate and update OSC Send Port
-  if (sendPortStr.length() > 0) {
-    int newSendPort = sendPortStr.toInt();
-    if (isValidPort(newSendPort)) {
-      netConfig.sendPort = newSendPort;
-      debugPrintf("Updated OSC Send Port: %d\n", netConfig.sendPort);
-    } else {
-      debugPrintf("ERROR: Invalid OSC send port: %d\n", newSendPort);
-      sendErrorResponse("Invalid OSC send port (must be 1-65535)");
-      return;
-    }
+  if (!isValidIP(cfg.sendToIP)) {
+    sendErrorResponse("Invalid OSC send IP address");
+    return;
   }
-  
-  // Validate and update OSC Receive Port
-  if (receivePortStr.length() > 0) {
-    int newReceivePort = receivePortStr.toInt();
-    if (isValidPort(newReceivePort)) {
-      netConfig.receivePort = newReceivePort;
-      // NEED TO UPDATE UDP HANDLER
-      debugPrintf("Updated OSC Receive Port: %d\n", netConfig.receivePort);
-    } else {
-      debugPrintf("ERROR: Invalid OSC receive port: %d\n", newReceivePort);
-      sendErrorResponse("Invalid OSC receive port (must be 1-65535)");
+
+  // Extra destinations, unchecked boxes are simply missing from the request
+  OscDestination dests[OSC_MAX_DESTINATIONS];
+  for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+    char keys[5][12];
+    snprintf(keys[0], sizeof(keys[0]), "dest%d_en", d);
+    snprintf(keys[1], sizeof(keys[1]), "dest%d_bc", d);
+    snprintf(keys[2], sizeof(keys[2]), "dest%d_tcp", d);
+    snprintf(keys[3], sizeof(keys[3]), "dest%d_ip", d);
+    snprintf(keys[4], sizeof(keys[4]), "dest%d_port", d);
+
+    OscDestination &dest = dests[d];
+    dest = oscDestinations[d];
+    const FormBinding destBindings[] = {
+      { keys[0], FORM_CHECKBOX, &dest.enabled,   0, 0 },
+      { keys[1], FORM_CHECKBOX, &dest.broadcast, 0, 0 },
+      { keys[2], FORM_CHECKBOX, &dest.tcp,       0, 0 },
+      { keys[3], FORM_IP,       &dest.ip,        0, 0 },
+      { keys[4], FORM_UINT16,   &dest.port,      0, 65535 },
+    };
+
+    badField = formBind(form, destBindings, FORM_BINDING_COUNT(destBindings));
+    if (badField || (dest.enabled && ((!dest.broadcast && !isValidIP(dest.ip)) || !isValidPort(dest.port)))) {
+      debugPrintf("ERROR: Invalid OSC destination %d\n", d + 1);
+      sendErrorResponse("Invalid additional OSC destination (check IP and port)");
       return;
     }
   }
-  
+
+  netConfig = cfg;
+  for (int d = 0; d < OSC_MAX_DESTINATIONS; d++) {
+    oscDestinations[d] = dests[d];   // IPAddress has a vtable, no memcpy
+  }
+  debugPrintf("Updated OSC Send: %s:%d, receive port %d\n",
+              ipToString(netConfig.sendToIP).c_str(), netConfig.sendPort, netConfig.receivePort);
+
   // Save to EEPROM
 
   
- // Send success response with improved styling
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/html");
-  client.println("Connection: close");
-  client.println();
-  client.println("<html><head>");
-  client.println("<meta name='viewport' content='width=device-width, initial-scale=1'>");
-  client.println("<style>");
-  client.println("body { font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif; margin: 0; padding: 20px; background: #f5f5f5; }");
-  client.println(".success-container { background: white; border-radius: 8px; padding: 30px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); max-width: 500px; margin: 50px auto; }");
-  client.println("h1 { color: #2e7d32; margin-top: 0; }");
-  client.println("p { color: #666; line-height: 1.6; }");
-  client.println("a { color: #1976d2; text-decoration: none; font-weight: 500; }");
-  client.println("a:hover { text-decoration: underline; }");
-  client.println("</style></head><body>");
-  client.println("<div class='success-container'>");
-  client.println("<h1>OSC Settings Saved</h1>");
-  client.println("<p>OSC settings have been saved successfully. For changes to take full effect, you may have to restart the device.</p>");
-  client.println("<p><a href='/osc_settings'>Return to OSC settings</a></p>");
-  client.println("</div></body></html>");
+  sendMessagePage("200 OK", "success", "OSC Settings Saved",
+                  "OSC settings have been saved successfully. For changes to take full effect, "
+                  "you may have to restart the device.", "/osc_settings");
 
     saveNetworkConfig();
+    saveOscDestinations();
     
     restartUDP();
 
@@ -727,26 +1032,9 @@ void handleOSCSettings(String request) {
 
 
 void handleNetworkReset() {  
-  // Special response for network settings with improved styling
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/html");
-  client.println("Connection: close");
-  client.println();
-  client.println("<html><head>");
-  client.println("<meta name='viewport' content='width=device-width, initial-scale=1'>");
-  client.println("<style>");
-  client.println("body { font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif; margin: 0; padding: 20px; background: #f5f5f5; }");
-  client.println(".success-container { background: white; border-radius: 8px; padding: 30px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); max-width: 500px; margin: 50px auto; }");
-  client.println("h1 { color: #f57c00; margin-top: 0; }");
-  client.println("p { color: #666; line-height: 1.6; }");
-  client.println("a { color: #1976d2; text-decoration: none; font-weight: 500; }");
-  client.println("a:hover { text-decoration: underline; }");
-  client.println("</style></head><body>");
-  client.println("<div class='success-container'>");
-  client.println("<h1>Network Settings Reset</h1>");
-  client.println("<p>Network settings have been reset to defaults. For changes to take full effect, please restart the device.</p>");
-  client.println("<p><a href='/'>Return to settings</a></p>");
-  client.println("</div></body></html>");
+  sendMessagePage("200 OK", "notice", "Network Settings Reset",
+                  "Network settings have been reset to defaults. For changes to take full effect, "
+                  "please restart the device.", "/");
   
   debugPrint("Resetting network settings to defaults...");
   resetNetworkDefaults();
@@ -759,365 +1047,4 @@ void sendRedirect() {
   client.println();
 }
 
-// Helper function to send CSS styles
-void sendCommonStyles() {
-  client.println("<style>");
-  client.println("body { font-family: Arial, sans-serif; margin: 0; padding: 0; background: #f0f0f0; }");
-  client.println(".header { background: #1976d2; color: white; padding: 20px; text-align: center; }");
-  client.println(".header h1 { margin: 0; font-size: 24px; }");
-  client.println(".header p { margin: 5px 0; font-size: 14px; }");
-  client.println(".nav { background: #333; padding: 10px; text-align: center; }");
-  client.println(".nav a { color: white; text-decoration: none; padding: 5px 15px; margin: 0 5px; }");
-  client.println(".nav a:hover { background: #555; }");
-  client.println(".container { max-width: 600px; margin: 20px auto; padding: 0 20px; }");
-  client.println(".card { background: white; padding: 20px; margin-bottom: 20px; border: 1px solid #ddd; }");
-  client.println(".card h2 { margin-top: 0; font-size: 20px; border-bottom: 1px solid #ddd; padding-bottom: 10px; }");
-  client.println("input[type='text'], input[type='number'], select { width: 100%; padding: 8px; margin: 5px 0; box-sizing: border-box; }");
-  client.println("label { display: block; margin-top: 10px; font-weight: bold; }");
-  client.println(".help { font-size: 12px; color: #666; margin-top: 2px; }");
-  client.println("button { background: #1976d2; color: white; padding: 10px 20px; border: none; cursor: pointer; width: 100%; margin-top: 10px; }");
-  client.println("button:hover { background: #1565c0; }");
-  client.println(".divider { border-top: 1px solid #ddd; margin: 20px 0; }");
-  client.println("</style>");
-}
-
-// Helper function to send navigation header
-void sendNavigationHeader(const char* pageTitle) {
-  client.println("<div class='header'>");
-  client.println("<h1>EvoFaderWing Configuration</h1>");
-  client.print("<p>IP: ");
-  client.print(ipToString(Ethernet.localIP()));
-  client.println("</p>");
-  client.println("</div>");
-  
-  client.println("<div class='nav'>");
-  client.println("<a href='/'>Network/Debug</a>");
-  client.println("<a href='/osc_settings'>OSC</a>");
-  client.println("<a href='/fader_settings'>Faders</a>");
-  client.println("<a href='/stats'>Statistics</a>");
-  client.println("</div>");
-}
-
-
-void handleStatsPage() {
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/html");
-  client.println("Connection: close");
-  client.println();
-  
-  client.println("<!DOCTYPE html><html><head><title>Fader Statistics</title>");
-  client.println("<meta name='viewport' content='width=device-width, initial-scale=1'>");
-  sendCommonStyles();
-  client.println("<style>");
-  client.println("table { width: 100%; border-collapse: collapse; }");
-  client.println("th, td { border: 1px solid #ddd; padding: 8px; text-align: left; }");
-  client.println("th { background: #f0f0f0; }");
-  client.println("</style>");
-  client.println("</head><body>");
-  
-  sendNavigationHeader("Statistics");
-  
-  client.println("<div class='container'>");
-  client.println("<div class='card'>");
-  client.println("<h2>Fader Statistics</h2>");
-  
-  client.println("<table>");
-  client.println("<tr><th>Fader</th><th>Current</th><th>Min</th><th>Max</th><th>OSC Value</th></tr>");
-  
-  for (int i = 0; i < NUM_FADERS; i++) {
-    Fader& f = faders[i];
-    int currentVal = analogRead(f.analogPin);
-    
-    client.print("<tr><td>Fader ");
-    client.print(i + 1);
-    client.print("</td><td>");
-    client.print(currentVal);
-    client.print("</td><td>");
-    client.print(f.minVal);
-    client.print("</td><td>");
-    client.print(f.maxVal);
-    client.print("</td><td>");
-    client.print(readFadertoOSC(faders[i]));
-    client.println("</td></tr>");
-    
-    if (i % 3 == 0) waitForWriteSpace();
-  }
-  
-  client.println("</table>");
-  client.println("</div>");
-  client.println("</div>");
-  client.println("</body></html>");
-}
-
-void handleFaderSettingsPage() {
-  // Send HTTP headers
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/html");
-  client.println("Connection: close");
-  client.println();
-  
-  // Send HTML head
-  client.println("<!DOCTYPE html><html><head><title>Fader Configuration</title>");
-  client.println("<meta name='viewport' content='width=device-width, initial-scale=1'>");
-  
-  // Send common styles
-  sendCommonStyles();
-  client.println("</head><body>");
-  
-  // Send navigation header
-  sendNavigationHeader("Fader Configuration");
-  
-  // Main container
-  client.println("<div class='container'>");
-  
-waitForWriteSpace();
-
-  // Fader Settings Card
-  client.println("<div class='card'>");
-  client.println("<div class='card-header'><h2>Fader Settings</h2></div>");
-  client.println("<div class='card-body'>");
-  client.println("<form method='get' action='/save'>");
-  
-  // Min PWM
-  client.println("<div class='form-group'>");
-  client.println("<label>Min PWM</label>");
-  client.print("<input type='number' name='minPwm' value='");
-  client.print(Fconfig.minPwm);
-  client.println("' min='0' max='255'>");
-  client.println("<p class='help-text'>Minimum motor speed (too low stalls motor, too high passes setpoint and causes jitter) (0-255)</p>");
-  client.println("</div>");
-  
-  // Default PWM
-  client.println("<div class='form-group'>");
-  client.println("<label>Default PWM Speed</label>");
-  client.print("<input type='number' name='defaultPwm' value='");
-  client.print(Fconfig.defaultPwm);
-  client.println("' min='0' max='255'>");
-  client.println("<p class='help-text'>Base motor speed (0-255)</p>");
-  client.println("</div>");
-  
-  // Target Tolerance
-  client.println("<div class='form-group'>");
-  client.println("<label>Target Tolerance</label>");
-  client.print("<input type='number' name='targetTolerance' value='");
-  client.print(Fconfig.targetTolerance);
-  client.println("' min='0' max='100'>");
-  client.println("<p class='help-text'>Position accuracy before motor stops</p>");
-  client.println("</div>");
-  
-waitForWriteSpace();
-
-  // Send Tolerance
-  client.println("<div class='form-group'>");
-  client.println("<label>Send Tolerance</label>");
-  client.print("<input type='number' name='sendTolerance' value='");
-  client.print(Fconfig.sendTolerance);
-  client.println("' min='0' max='100'>");
-  client.println("<p class='help-text'>Minimum movement before sending OSC update</p>");
-  client.println("</div>");
-  
-  // Brightness controls
-  client.println("<div class='divider'></div>");
-  client.println("<h3 style='margin-top: 0; margin-bottom: 16px; font-size: 16px;'>LED Brightness</h3>");
-  
-  client.println("<div class='form-group'>");
-  client.println("<label>Base Brightness</label>");
-  client.print("<input type='number' name='baseBrightness' value='");
-  client.print(Fconfig.baseBrightness);
-  client.println("' min='0' max='255'>");
-  client.println("<p class='help-text'>LED brightness when fader is not touched (0-255)</p>");
-  client.println("</div>");
-  
-  client.println("<div class='form-group'>");
-  client.println("<label>Touched Brightness</label>");
-  client.print("<input type='number' name='touchedBrightness' value='");
-  client.print(Fconfig.touchedBrightness);
-  client.println("' min='0' max='255'>");
-  client.println("<p class='help-text'>LED brightness when fader is touched (0-255)</p>");
-  client.println("</div>");
-  
-  client.println("<button type='submit' class='btn btn-primary btn-block'>Save Fader Settings</button>");
-  client.println("</form></div></div>");
-  
-
-  waitForWriteSpace();
-
-
-  // Calibration Card
-  client.println("<div class='card' style='margin-top: 20px;'>");
-  client.println("<div class='card-header'><h2>Calibration</h2></div>");
-  client.println("<div class='card-body'>");
-  
-  client.println("<form method='get' action='/save'>");
-  client.println("<div class='form-group'>");
-  client.println("<label>Calibration PWM Speed</label>");
-  client.print("<input type='number' name='calib_pwm' value='");
-  client.print(Fconfig.calibratePwm);
-  client.println("' min='0' max='255'>");
-  client.println("<p class='help-text'>Motor speed during calibration (lower = gentler)</p>");
-  client.println("</div>");
-  client.println("<button type='submit' class='btn btn-success btn-block'>Save Calibration Speed</button>");
-  client.println("</form>");
-  
-  client.println("<div class='divider'></div>");
-  
-  client.println("<form method='post' action='/calibrate'>");
-  client.println("<input type='hidden' name='calibrate' value='1'>");
-  client.println("<button type='submit' class='btn btn-info btn-block'>Run Fader Calibration</button>");
-  client.println("</form>");
-  client.println("</div></div>");
-  
-  // Touch Sensor Card
-  client.println("<div class='card' style='margin-top: 20px;'>");
-  client.println("<div class='card-header'><h2>Touch Sensor</h2></div>");
-  client.println("<div class='card-body'>");
-  client.println("<form method='get' action='/save'>");
-  
-waitForWriteSpace();
-
-  client.println("<div class='form-group'>");
-  client.println("<label>Auto Calibration Mode</label>");
-  client.println("<select name='autoCalMode'>");
-  client.print("<option value='0'");
-  if (autoCalibrationMode == 0) client.print(" selected");
-  client.println(">Disabled</option>");
-  client.print("<option value='1'");
-  if (autoCalibrationMode == 1) client.print(" selected");
-  client.println(">Normal (More sensitive, faster baseline changes)</option>");
-  client.print("<option value='2'");
-  if (autoCalibrationMode == 2) client.print(" selected");
-  client.println(">Conservative (Defualt, slower baseline changes due to environment)</option>");
-  client.println("</select>");
-  client.println("<p class='help-text'>Automatic baseline adjustment for environmental changes</p>");
-  client.println("</div>");
-  
-  client.println("<div class='form-group'>");
-  client.println("<label>Touch Threshold</label>");
-  client.print("<input type='number' name='touchThreshold' value='");
-  client.print(touchThreshold);
-  client.println("' min='1' max='255'>");
-  client.println("<p class='help-text'>Higher values = less sensitive (default: 12)</p>");
-  client.println("</div>");
-  
-waitForWriteSpace();
-
-  client.println("<div class='form-group'>");
-  client.println("<label>Release Threshold</label>");
-  client.print("<input type='number' name='releaseThreshold' value='");
-  client.print(releaseThreshold);
-  client.println("' min='1' max='255'>");
-  client.println("<p class='help-text'>Lower values = harder to release (default: 6)</p>");
-  client.println("</div>");
-  
-  client.println("<button type='submit' class='btn btn-primary btn-block'>Save Touch Settings</button>");
-  client.println("<p class='help-text' style='margin-top: 12px; color: red;'>Do not touch faders while saving</p>");
-  client.println("</form></div></div>");
-  
-  client.println("</div>"); // End container
-  client.println("</body></html>");
-}
-
-//================================
-// MAIN WEB PAGE HANDLER (ROOT - Network Settings)
-//================================
-void handleRoot() {
-  // Send HTTP headers
-  client.println("HTTP/1.1 200 OK");
-  client.println("Content-Type: text/html");
-  client.println("Connection: close");
-  client.println();
-  
-  // Send HTML head
-  client.println("<!DOCTYPE html><html><head><title>Network Settings</title>");
-  client.println("<meta name='viewport' content='width=device-width, initial-scale=1'>");
-  sendCommonStyles();
-  client.println("</head><body>");
-  
-  // Send navigation header
-  sendNavigationHeader("Network Settings");
-  
-  client.println("<div class='container'>");
-  
-  waitForWriteSpace();
-  
-  // Network Settings Card
-  client.println("<div class='card'>");
-  client.println("<h2>Network Settings</h2>");
-  
-  client.println("<form method='get' action='/save'>");
-  
-  client.println("<label>");
-  client.print("<input type='checkbox' name='dhcp' value='on'");
-  if (netConfig.useDHCP) client.print(" checked");
-  client.println("> Use DHCP");
-  client.println("</label>");
-  client.println("<p class='help'>When enabled, static IP settings below are ignored</p>");
-  
-  client.println("<label>Static IP Address</label>");
-  client.print("<input type='text' name='ip' value='");
-  client.print(ipToString(netConfig.staticIP));
-  client.println("'>");
-  
-  client.println("<label>Gateway</label>");
-  client.print("<input type='text' name='gw' value='");
-  client.print(ipToString(netConfig.gateway));
-  client.println("'>");
-  
-  client.println("<label>Subnet Mask</label>");
-  client.print("<input type='text' name='sn' value='");
-  client.print(ipToString(netConfig.subnet));
-  client.println("'>");
-  
-  client.println("<button type='submit'>Save Network Settings</button>");
-  client.println("</form>");
-  
-  client.println("<form method='post' action='/reset_network'>");
-  client.println("<button type='submit' onclick=\"return confirm('Reset network settings?');\">Reset Network</button>");
-  client.println("</form>");
-  
-  client.println("</div>");
-  
-  waitForWriteSpace();
-  
-  // Debug Tools Card
-  client.println("<div class='card'>");
-  client.println("<h2>Debug Tools</h2>");
-  
-  client.println("<form method='post' action='/debug'>");
-  client.println("<input type='hidden' name='debug' value='0'>");
-  client.println("<label>");
-  client.print("<input type='checkbox' name='debug' value='1'");
-  if (debugMode) client.print(" checked");
-  client.println("> Enable Serial Debug Output");
-  client.println("</label>");
-  client.println("<button type='submit'>Save Debug Setting</button>");
-  client.println("</form>");
-  
-  client.println("<div class='divider'></div>");
-  
-  client.println("<form method='post' action='/dump'>");
-  client.println("<button type='submit'>Dump EEPROM to Serial</button>");
-  client.println("</form>");
-  
-  client.println("</div>");
-  
-  waitForWriteSpace();
-  
-  // Factory Reset Card
-  client.println("<div class='card'>");
-  client.println("<h2>Factory Reset</h2>");
-  client.println("<p>This will reset all settings to factory defaults.</p>");
-  client.println("<form method='post' action='/reset_defaults'>");
-  client.println("<button type='submit' onclick=\"return confirm('Reset ALL settings?');\">Reset All Settings</button>");
-  client.println("</form>");
-  client.println("</div>");
-  
-  client.println("</div>"); // End container
-  client.println("</body></html>");
-}
 
-void waitForWriteSpace() {
-  while (client.connected() && client.availableForWrite() < 100) {
-    delay(1);
-  }
-}
\ No newline at end of file
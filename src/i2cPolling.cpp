@@ -11,6 +11,9 @@
 #include "Utils.h"
 #include "EEPROMStorage.h"
 #include "NetworkOSC.h"
+#include "OSCWriter.h"
+#include "Config.h"
+#include "Profiler.h"
 
 // === I2C Slave Addresses ===
 #define I2C_ADDR_KEYBOARD  0x10  // Keyboard matrix ATmega - sends keypress data
@@ -34,15 +37,45 @@ const int numSlaves = sizeof(slaveAddresses) / sizeof(slaveAddresses[0]);
 #define DATA_TYPE_ENCODER  0x01  // Data type identifier for encoder rotation messages
 #define DATA_TYPE_KEYPRESS 0x02  // Data type identifier for keypress/release messages
 
+// === Precomputed OSC Addresses ===
+// Built once in setupI2cPolling() so sends don't need snprintf
+#define NUM_ENCODERS      21   // Encoder numbers 0-20 accepted from slaves
+#define NUM_KEY_BANKS     4    // Keys 101-110, 201-210, 301-310, 401-410
+#define KEYS_PER_BANK     10
+static OscAddress encoderOscAddress[NUM_ENCODERS];
+static OscAddress keyOscAddress[NUM_KEY_BANKS][KEYS_PER_BANK];
+
+// === Encoder Coalescing ===
+// Signed steps summed per encoder since the last flush
+static int encoderAccum[NUM_ENCODERS] = { 0 };
+static bool encoderWindowOpen = false;
+static unsigned long encoderWindowStart = 0;
+static EncoderStats encoderStats = { 0, 0 };
+
 // === Simplified Timing Variables (separate from original) ===
 unsigned long lastPollTimeSimple = 0;          
 const unsigned long I2C_POLL_INTERVAL_SIMPLE = 10;    // Poll every 10ms instead of 1ms
+const unsigned long I2C_SLAVE_GAP_US = 1000;          // Between two slaves of one poll cycle
+static int nextSlave = 0;                             // Slave polled on the next call, 0 starts a cycle
+static unsigned long lastSlavePollMicros = 0;
 
 // === SIMPLIFIED SETUP FUNCTION ===
 // Call this INSTEAD of setupI2cPolling() in your main setup()
 void setupI2cPolling() {
   Wire.begin();                
   Wire.setClock(400000);       // 400kHz
+
+  // Build OSC address templates for every encoder and key
+  for (int e = 0; e < NUM_ENCODERS; e++) {
+    // Encoders 0-10 map to ExecutorKnob400-410, encoders 11-20 to ExecutorKnob301-310
+    int executorKnobNumber = (e < 11) ? 400 + e : 300 + (e - 10);
+    oscAddressFormat(encoderOscAddress[e], "/Encoder%d", executorKnobNumber);
+  }
+  for (int bank = 0; bank < NUM_KEY_BANKS; bank++) {
+    for (int k = 0; k < KEYS_PER_BANK; k++) {
+      oscAddressFormat(keyOscAddress[bank][k], "/Key%d", (bank + 1) * 100 + k + 1);
+    }
+  }
   
   debugPrint("[I2C] Polling Init");
   debugPrintf("Polling %d slaves every %lums...", numSlaves, I2C_POLL_INTERVAL_SIMPLE);
@@ -60,32 +93,41 @@ void setupI2cPolling() {
 
 // === SIMPLIFIED MAIN POLLING FUNCTION ===
 // Call this INSTEAD of handleI2c() in your main loop()
+// One slave per call, I2C_SLAVE_GAP_US apart, so a poll cycle never holds
+// up the other critical tasks for the whole round
 void handleI2c() { 
   unsigned long currentTime = millis();  
-  
-  if (currentTime - lastPollTimeSimple >= I2C_POLL_INTERVAL_SIMPLE) {
-    lastPollTimeSimple = currentTime;  
-    
-    // Poll each slave with extra safety
-    for (int i = 0; i < numSlaves; i++) {
-      pollSlave(slaveAddresses[i], i);  
-      delay(1); // Small delay between slave polls
-    }
+
+  if (nextSlave == 0) {
+    if (currentTime - lastPollTimeSimple < I2C_POLL_INTERVAL_SIMPLE) return;
+    lastPollTimeSimple = currentTime;
+  } else if (micros() - lastSlavePollMicros < I2C_SLAVE_GAP_US) {
+    return; // Small gap between slave polls
+  }
+
+  pollSlave(slaveAddresses[nextSlave], nextSlave);
+  lastSlavePollMicros = micros();
+
+  if (++nextSlave >= numSlaves) {
+    nextSlave = 0;
+
+    // Send one message per encoder that moved during this window
+    flushEncoderOSC();
   }
 }
 
 // === SIMPLIFIED SLAVE POLLING ===
 void pollSlave(uint8_t address, int slaveIndex) {
+  PROFILE_ZONE("i2c_slave");
+
   // Clear any leftover data first
   while (Wire.available()) Wire.read();
   
   // Request data from slave
   uint8_t bytesRequested = 16; // Smaller request size
+  // Returns once the transfer is done, the bytes are already buffered
   Wire.requestFrom(address, bytesRequested);
   
-  // Wait a bit for response
-  delay(1);
-  
   // Check if we got minimum required data
   if (Wire.available() < 2) {
     return; // No data or insufficient data
@@ -174,10 +216,53 @@ void processEncoderData(uint8_t count, uint8_t address) {
     
     debugPrintf("  Encoder %d: %s%d", encoderNumber, isPositive ? "+" : "-", velocity);
     
-    sendEncoderOSC(encoderNumber, isPositive, velocity);                                   //ENCODER OSC SEND
+    accumulateEncoder(encoderNumber, isPositive ? (int)velocity : -(int)velocity);      //ENCODER OSC SEND (coalesced)
   }
 }
 
+// === ENCODER COALESCING ===
+// Add one event to the encoder's running sum, applying the acceleration curve
+void accumulateEncoder(int encoderNumber, int signedVelocity) {
+  if (encoderNumber < 0 || encoderNumber >= NUM_ENCODERS) return;
+
+  int velocity = abs(signedVelocity);
+  int steps = velocity + (velocity * (velocity - 1) * ENCODER_ACCEL_PERCENT) / 100;
+  int sum = encoderAccum[encoderNumber] + (signedVelocity < 0 ? -steps : steps);
+  encoderAccum[encoderNumber] = constrain(sum, -ENCODER_MAX_STEPS, ENCODER_MAX_STEPS);
+
+  encoderStats.events++;
+
+  if (!encoderWindowOpen) {
+    encoderWindowOpen = true;
+    encoderWindowStart = millis();
+  }
+}
+
+// Send the summed steps for every encoder once the window has passed
+void flushEncoderOSC(bool force) {
+  if (!encoderWindowOpen) return;
+#if ENCODER_COALESCE_MS > 0
+  if (!force && (millis() - encoderWindowStart) < ENCODER_COALESCE_MS) return;
+#else
+  (void)force;   // Flushed once per I2C poll cycle anyway
+#endif
+
+  for (int e = 0; e < NUM_ENCODERS; e++) {
+    int sum = encoderAccum[e];
+    if (sum == 0) continue;   // No movement, or turns that cancelled out
+
+    encoderAccum[e] = 0;
+    sendEncoderOSC(e, sum > 0, abs(sum));
+    encoderStats.messages++;
+  }
+
+  encoderWindowOpen = false;
+}
+
+const EncoderStats &getEncoderStats() {
+  return encoderStats;
+}
+
 // === KEYPRESS PROCESSING ===
 void processKeypressData(uint8_t count, uint8_t address) {
   if (count == 0) return;
@@ -232,54 +317,23 @@ void sendEncoderOSC(int encoderNumber, bool isPositive, int velocity) {
     return;
   }
 
-    // Create the OSC address based on encoder number mapping
-  char oscAddress[32];
-  int executorKnobNumber;
-  if (encoderNumber < 11) {
-      // Encoders 0-9 map to ExecutorKnob401-410
-    executorKnobNumber = 400 + encoderNumber;
-  } else {
-      // Encoders 10-19 map to ExecutorKnob301-310
-    executorKnobNumber = 300 + (encoderNumber - 10);
-  }
-
-    // Format the OSC address
-  snprintf(oscAddress, sizeof(oscAddress), "/Encoder%d", executorKnobNumber);
     // Create signed velocity value
   int signedVelocity = isPositive ? (int)velocity : -(int)velocity;
 
-    // Send the OSC message
-  sendOscMessage(oscAddress, ",i", &signedVelocity);
+    // Send the OSC message using the precomputed address
+  do {
+    OscWriter &w = beginOscMessage();
+    w.beginMessage(encoderOscAddress[encoderNumber], ",i");
+    w.addInt(signedVelocity);
+  } while (!endOscMessage());
 
     // Debug output
-  debugPrintf("[OSC] Sent: %s %d (encoder %d)", oscAddress, signedVelocity, encoderNumber);
+  debugPrintf("[OSC] Sent: %s %d (encoder %d)", encoderOscAddress[encoderNumber].data, signedVelocity, encoderNumber);
 
 }
 
 
 
-// === PERFORMANCE MEASUREMENT FUNCTION ===
-// Alternative polling function that measures the time taken to poll all slaves
-// Useful for performance tuning and verifying that polling stays within timing budget
-void measurePollingSpeed() {
-  unsigned long startTime = micros();  // Get high-precision start timestamp
-  
-  // Poll all slaves once, just like the normal polling cycle
-  for (int i = 0; i < numSlaves; i++) {
-    pollSlave(slaveAddresses[i], i);
-  }
-  
-  unsigned long endTime = micros();    // Get high-precision end timestamp
-  unsigned long totalTime = endTime - startTime;  // Calculate elapsed time
-  
-  // Output timing information for performance analysis using project's debug system
-  debugPrintf("[TIMING] Polled %d slaves in %lu microseconds", numSlaves, totalTime);
-  
-  // Note: With 5 slaves at 400kHz I2C, total time should be around 2000-3000 microseconds
-  // This leaves plenty of time in each 1ms polling cycle for other system operations
-}
-
-
 void sendKeyOSC(uint16_t keyNumber, uint8_t state) {
   // Validate key number is in expected ranges
   if (!((keyNumber >= 101 && keyNumber <= 110) ||
@@ -296,17 +350,20 @@ void sendKeyOSC(uint16_t keyNumber, uint8_t state) {
     return;
   }
   
-  // Create the OSC address
-  char oscAddress[32];
-  snprintf(oscAddress, sizeof(oscAddress), "/Key%d", keyNumber);
+  // Look up the precomputed OSC address
+  const OscAddress &address = keyOscAddress[keyNumber / 100 - 1][keyNumber % 100 - 1];
   
   // Convert state to int for OSC message
   int keyState = (int)state;
   
   // Send the OSC message
-  sendOscMessage(oscAddress, ",i", &keyState);
+  do {
+    OscWriter &w = beginOscMessage();
+    w.beginMessage(address, ",i");
+    w.addInt(keyState);
+  } while (!endOscMessage());
   
   // Debug output
   debugPrintf("[OSC] Sent: %s %d (key %d %s)", 
-             oscAddress, keyState, keyNumber, state ? "PRESSED" : "RELEASED");
+             address.data, keyState, keyNumber, state ? "PRESSED" : "RELEASED");
 }
\ No newline at end of file
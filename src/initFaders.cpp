@@ -2,10 +2,9 @@
 
 #include "FaderControl.h"
 #include "Utils.h"
-#include "WebServer.h"
-
-// Calibration timeout in milliseconds
-const unsigned long calibrationTimeout = 2000;
+#include "TouchSensor.h"
+#include "EEPROMStorage.h"
+#include "OLED.h"
 
 //================================
 // FADER INITIALIZATION
@@ -28,10 +27,14 @@ void initializeFaders() {
     faders[i].lastMoveTime = 0;
     faders[i].lastOscSendTime = 0;
     faders[i].suppressOSCOut = false;
+    faders[i].calibrating = false;
     faders[i].oscID = OSC_IDS[i];
     
     
     faders[i].lastSentOscValue = -1;
+    faders[i].oscTokens = OSC_RATE_BURST;
+    faders[i].oscTokenTime = 0;
+    faders[i].pendingOscValue = -1;
     
     // Initialize color
     faders[i].red = Fconfig.baseBrightness;
@@ -44,6 +47,9 @@ void initializeFaders() {
     faders[i].touchStartTime = 0;
     faders[i].touchDuration = 0;
     faders[i].releaseTime = 0;
+    faders[i].touchStartMicros = 0;
+    faders[i].touchLatencyPending = false;
+    faders[i].touchLatencyQueued = false;
 
     // Initialize brightness values
     faders[i].currentBrightness = Fconfig.baseBrightness;
@@ -81,108 +87,257 @@ void configureFaderPins() {
 
 
 //================================
-// CALIBRATION
+// CALIBRATION JOB
 //================================
+// One fader at a time: drive up until the reading plateaus, rest, drive
+// down until it plateaus again. Each step is a non-blocking check from
+// serviceCalibration(), so OSC, keys and the web UI keep running and the
+// faders not reached yet keep following the console.
 
-void calibrateFaders() {
-  debugPrintf("Calibration started at PWM: %d\n", Fconfig.calibratePwm);
-  for (int i = 0; i < NUM_FADERS; i++) {
-    Fader& f = faders[i];
-    
-    // ==================== MAX VALUE CALIBRATION ====================
-    debugPrintf("Fader %d → Calibrating Max...\n", i);
-    analogWrite(f.pwmPin, Fconfig.calibratePwm);
-    digitalWrite(f.dirPin1, HIGH); digitalWrite(f.dirPin2, LOW);
-    int last = 0, plateau = 0;
-    
-    // Add timeout for max calibration
-    unsigned long startTime = millis();
-    bool calibrationSuccess = false;
-    
-    while (plateau < PLATEAU_COUNT) {
-      // Check for timeout (10 seconds)
-      if ((millis() - startTime) > calibrationTimeout) {
-        debugPrintf("ERROR: Fader %d MAX calibration timed out! Using default value of 1023.\n", i);
-        f.maxVal = 1000;  // Use default max value
-        calibrationSuccess = false;
-        break;  // Exit the loop
-      }
-      
-      int val = analogRead(f.analogPin);
-      plateau = (abs(val - last) < PLATEAU_THRESH) ? plateau + 1 : 0;
-      last = val;
-      delay(10);
-      
-      pollWebServer();  // Allow web UI to remain responsive
-      yield();          // Let MPR121 and Ethernet process in background
-      
-      // If we reach this point with required plateau count, calibration succeeded
-      if (plateau >= PLATEAU_COUNT) {
-        calibrationSuccess = true;
-        f.maxVal = last - 10;  //subtract a litle value to make sure we can get to top
-      }
-    }
-    
-    // Stop motor
-    analogWrite(f.pwmPin, 0);
-    delay(500);
+static CalibrationJob job = { CAL_IDLE };
+static unsigned long lastCalibrationDisplay = 0;
 
-    // ==================== MIN VALUE CALIBRATION ====================
-    debugPrint("→ Calibrating Min...");
+static void stopCalibrationMotor(Fader &f) {
+  analogWrite(f.pwmPin, 0);
+  digitalWrite(f.dirPin1, LOW);
+  digitalWrite(f.dirPin2, LOW);
+}
+
+static void beginCalibrationPhase(CalibrationPhase phase) {
+  Fader &f = faders[job.fader];
+  job.phase = phase;
+  job.phaseStart = millis();
+  job.lastSample = 0;
+  job.plateau = 0;
+
+  if (phase == CAL_FIND_MAX) {
+    debugPrintf("Fader %d → Calibrating Max...\n", job.fader);
+    job.lastReading = 0;
+    digitalWrite(f.dirPin1, HIGH); digitalWrite(f.dirPin2, LOW);
     analogWrite(f.pwmPin, Fconfig.calibratePwm);
+  } else if (phase == CAL_FIND_MIN) {
+    debugPrint("→ Calibrating Min...");
     digitalWrite(f.dirPin1, LOW); digitalWrite(f.dirPin2, HIGH);
-    plateau = 0;
-    
-    // Reset for min calibration
-    startTime = millis();
-    bool minCalibrationSuccess = false;
-    
-    while (plateau < PLATEAU_COUNT) {
-      // Check for timeout (10 seconds)
-      if ((millis() - startTime) > calibrationTimeout) {
-        debugPrintf("ERROR: Fader %d MIN calibration timed out! Using default value of 0.\n", i);
-        f.minVal = 20;  // Use default min value
-        minCalibrationSuccess = false;
-        break;  // Exit the loop
-      }
-      
-      int val = analogRead(f.analogPin);
-      plateau = (abs(val - last) < PLATEAU_THRESH) ? plateau + 1 : 0;
-      last = val;
-      delay(10);
-
-      pollWebServer();  // Allow web UI to remain responsive
-      yield();          // Let MPR121 and Ethernet process in background
-      
-      // If we reach this point with required plateau count, calibration succeeded
-      if (plateau >= PLATEAU_COUNT) {
-        minCalibrationSuccess = true;
-        f.minVal = last + 10;  //Add a litle value to make sure we can get to bottom
+    analogWrite(f.pwmPin, Fconfig.calibratePwm);
+  }
+}
+
+static void beginCalibrationFader(int index) {
+  job.fader = index;
+  job.outcome[index] = CAL_RUNNING;
+  job.heldSetpoint[index] = (int)faders[index].setpoint;   // Goes back there when the run ends
+  faders[index].calibrating = true;
+  beginCalibrationPhase(CAL_FIND_MAX);
+}
+
+static void updateCalibrationDisplay(bool force) {
+  unsigned long now = millis();
+  if (!force && now - lastCalibrationDisplay < CALIBRATION_OLED_MS) return;
+  lastCalibrationDisplay = now;
+
+  char line[32];
+  if (job.phase != CAL_IDLE) {
+    snprintf(line, sizeof(line), "CAL F%d %s %d%%", job.fader + 1,
+             calibrationPhaseName(job.phase), calibrationProgress());
+  } else {
+    snprintf(line, sizeof(line), "CAL %s", job.cancelled ? "cancelled" : "done");
+  }
+  display.showStatus(line);
+  display.display();
+}
+
+// Releases a held fader back to the console value it was following, or to
+// the newest one that came in meanwhile
+static void releaseCalibrationFader(int i) {
+  Fader &f = faders[i];
+  if (job.heldSetpoint[i] >= 0) f.setpoint = job.heldSetpoint[i];
+  job.heldSetpoint[i] = -1;
+  f.calibrating = false;
+}
+
+// All faders done: apply the staged values and save them once
+static void completeCalibration() {
+  for (int i = 0; i < NUM_FADERS; i++) {
+    faders[i].minVal = job.minVal[i];
+    faders[i].maxVal = job.maxVal[i];
+    releaseCalibrationFader(i);
+  }
+  job.phase = CAL_IDLE;
+  job.finished = true;
+  saveCalibration();
+
+  // Reinitialize MPR121 after calibration due to I2C hang risk
+  setupTouch();
+
+  moveAllFadersToSetpoints();
+
+  debugPrint("Calibration complete");
+  updateCalibrationDisplay(true);
+}
+
+static void finishCalibrationFader() {
+  int i = job.fader;
+  Fader &f = faders[i];
+
+  if (job.outcome[i] == CAL_OK) {
+    debugPrintf("→ Calibration Done: Min=%d Max=%d\n", job.minVal[i], job.maxVal[i]);
+  } else {
+    debugPrintf("→ Calibration INCOMPLETE for Fader %d: Min=%d Max=%d (Defaults applied where needed)\n",
+                i, job.minVal[i], job.maxVal[i]);
+  }
+
+  // If min > max or they're too close, use defaults
+  if (job.minVal[i] >= job.maxVal[i] || (job.maxVal[i] - job.minVal[i]) < 100) {
+    debugPrintf("ERROR: Fader %d has invalid range! Min=%d, Max=%d. Using defaults.\n",
+                i, job.minVal[i], job.maxVal[i]);
+    job.minVal[i] = 20;
+    job.maxVal[i] = 1000;
+    job.outcome[i] = CAL_INVALID;
+  }
+
+  // Hold where it is, in the new range, until the run completes. It stays
+  // calibrating so motion does not drive it with the old range meanwhile,
+  // and the console value it had is restored on release.
+  f.setpoint = analogToOSC(analogRead(f.analogPin), job.minVal[i], job.maxVal[i]);
+
+  if (i + 1 < NUM_FADERS) {
+    beginCalibrationFader(i + 1);
+  } else {
+    completeCalibration();
+  }
+}
+
+bool startCalibration() {
+  if (job.phase != CAL_IDLE) return false;
+
+  debugPrintf("Calibration started at PWM: %d\n", Fconfig.calibratePwm);
+  job.cancelled = false;
+  job.finished = false;
+  for (int i = 0; i < NUM_FADERS; i++) {
+    job.outcome[i] = CAL_PENDING;
+    job.minVal[i] = faders[i].minVal;
+    job.maxVal[i] = faders[i].maxVal;
+    job.heldSetpoint[i] = -1;
+  }
+  beginCalibrationFader(0);
+  updateCalibrationDisplay(true);
+  return true;
+}
+
+// Stops the motor, the previous calibration stays in use
+void cancelCalibration() {
+  if (job.phase == CAL_IDLE) return;
+
+  stopCalibrationMotor(faders[job.fader]);
+  job.outcome[job.fader] = CAL_PENDING;
+
+  // Faders already done go back to their console values in the old range
+  for (int i = 0; i <= job.fader; i++) {
+    releaseCalibrationFader(i);
+  }
+  job.phase = CAL_IDLE;
+  job.cancelled = true;
+  moveAllFadersToSetpoints();
+
+  debugPrint("Calibration cancelled");
+  updateCalibrationDisplay(true);
+}
+
+void serviceCalibration() {
+  if (job.phase == CAL_IDLE) return;
+
+  unsigned long now = millis();
+  Fader &f = faders[job.fader];
+
+  if (job.phase == CAL_SETTLE) {
+    if (now - job.phaseStart >= CALIBRATION_SETTLE_MS) beginCalibrationPhase(CAL_FIND_MIN);
+    updateCalibrationDisplay(false);
+    return;
+  }
+
+  if (now - job.lastSample < CALIBRATION_SAMPLE_MS) return;
+  job.lastSample = now;
+
+  int val = analogRead(f.analogPin);
+  job.plateau = (abs(val - job.lastReading) < PLATEAU_THRESH) ? job.plateau + 1 : 0;
+  job.lastReading = val;
+
+  bool found = job.plateau >= PLATEAU_COUNT;
+  bool timedOut = now - job.phaseStart > CALIBRATION_TIMEOUT_MS;
+  if (found || timedOut) {
+    stopCalibrationMotor(f);
+
+    if (job.phase == CAL_FIND_MAX) {
+      if (found) {
+        job.maxVal[job.fader] = val - 10;  //subtract a litle value to make sure we can get to top
+        job.outcome[job.fader] = CAL_OK;
+      } else {
+        debugPrintf("ERROR: Fader %d MAX calibration timed out! Using default value of 1000.\n", job.fader);
+        job.maxVal[job.fader] = 1000;
+        job.outcome[job.fader] = CAL_TIMEOUT;
       }
-    }
-    
-    // Stop motor
-    analogWrite(f.pwmPin, 0);
-    
-    // Output results with status indicator
-    if (calibrationSuccess && minCalibrationSuccess) {
-      debugPrintf("→ Calibration Done: Min=%d Max=%d\n", f.minVal, f.maxVal);
+      job.phase = CAL_SETTLE;
+      job.phaseStart = now;
     } else {
-      debugPrintf("→ Calibration INCOMPLETE for Fader %d: Min=%d Max=%d (Defaults applied where needed)\n", 
-                  i, f.minVal, f.maxVal);
-    }
-    
-    // Validate min and max values
-    // If min > max or they're too close, use defaults
-    if (f.minVal >= f.maxVal || (f.maxVal - f.minVal) < 100) {
-      debugPrintf("ERROR: Fader %d has invalid range! Min=%d, Max=%d. Using defaults.\n", 
-                  i, f.minVal, f.maxVal);
-      f.minVal = 20;
-      f.maxVal = 1000;
+      if (found) {
+        job.minVal[job.fader] = val + 10;  //Add a litle value to make sure we can get to bottom
+      } else {
+        debugPrintf("ERROR: Fader %d MIN calibration timed out! Using default value of 20.\n", job.fader);
+        job.minVal[job.fader] = 20;
+        job.outcome[job.fader] = CAL_TIMEOUT;
+      }
+      finishCalibrationFader();
     }
-    
-    
-    // Reset setpoint
-    f.setpoint = analogRead(f.analogPin);
   }
-}
\ No newline at end of file
+
+  updateCalibrationDisplay(false);
+}
+
+bool calibrationRunning() {
+  return job.phase != CAL_IDLE;
+}
+
+bool calibrationHoldSetpoint(int faderIndex, int oscValue) {
+  if (job.phase == CAL_IDLE || !faders[faderIndex].calibrating) return false;
+  job.heldSetpoint[faderIndex] = constrain(oscValue, 0, 100);
+  return true;
+}
+
+// Each fader counts as two halves, max and min
+uint8_t calibrationProgress() {
+  if (job.phase == CAL_IDLE) return job.finished ? 100 : 0;
+  int halves = job.fader * 2 + (job.phase == CAL_FIND_MAX ? 0 : 1);
+  return halves * 100 / (NUM_FADERS * 2);
+}
+
+const CalibrationJob &getCalibrationJob() {
+  return job;
+}
+
+const char *calibrationPhaseName(CalibrationPhase phase) {
+  switch (phase) {
+    case CAL_FIND_MAX: return "max";
+    case CAL_SETTLE:   return "settle";
+    case CAL_FIND_MIN: return "min";
+    default:           return "idle";
+  }
+}
+
+const char *calibrationOutcomeName(CalibrationOutcome outcome) {
+  switch (outcome) {
+    case CAL_RUNNING: return "running";
+    case CAL_OK:      return "ok";
+    case CAL_TIMEOUT: return "timeout";
+    case CAL_INVALID: return "invalid";
+    default:          return "pending";
+  }
+}
+
+// Blocking run, used at boot before the main loop starts
+void calibrateFaders() {
+  if (!startCalibration()) return;
+  while (calibrationRunning()) {
+    serviceCalibration();
+    yield();
+  }
+}
@@ -19,11 +19,17 @@
 #include "Utils.h"
 #include "i2cPolling.h"
 #include "OLED.h"
+#include "Metrics.h"
+#include "Telemetry.h"
+#include "Arena.h"
+#include "Scheduler.h"
+#include "Profiler.h"
 
 using namespace qindesign::network;
 using qindesign::osc::LiteOSCParser;
 
 void updateBrightnessOnFaderTouchChange();
+static void setupTasks();
 
 unsigned long lastI2CPollTime = 0;     // Time of last I2C poll cycle
 
@@ -50,12 +56,16 @@ void setup() {
     debugPrint("Touch sensor initialization failed!");
   }
 
+  // Roll back a settings save that a power loss cut short
+  recoverConfigJournal();
+
     // Check calibration will load calibration data if present ortherwise it will run calibration
   checkCalibration(); 
 
   // Load configurations from EEPROM
   loadAllConfig();
 
+  // Starts the move to the boot setpoints, the faders task finishes it
   moveAllFadersToSetpoints();
 
   //Setup I2C Slaves so we can also check for network reset
@@ -67,6 +77,9 @@ void setup() {
   // Set up network connection
   setupNetwork();
 
+  // Build OSC address routes and executor ID lookup
+  setupOscRoutes();
+
   displayIPAddress();
 
   // Start web server for configuration
@@ -81,49 +94,77 @@ void setup() {
   //Network reset check
   resetCheckStartTime = millis();
 
+  setupTasks();
+
   debugPrint("Initialization complete");
+
+  // Everything after this runs from static buffers and arenas
+  heapMarkBoot();
 }
 
 void loop() {
-  // Network reset check exiry
-  if (checkForReset && (millis() - resetCheckStartTime > 10000)) {
-    checkForReset = false;
-    debugPrint("[RESET] Reset check window expired.");
+  uint32_t loopStart = ARM_DWT_CYCCNT;
+
+  {
+    PROFILE_ZONE("loop");
+    runScheduler();
   }
-  
-// Process OSC messages
-  handleOscMessage();
 
-  // Check for manual fader movement
-  handleFaders();
+  // Loop timing for /metrics and the telemetry stream
+  uint32_t loopCycles = ARM_DWT_CYCCNT - loopStart;
+  metricsRecordTiming(TIMING_LOOP, loopCycles);
+  telemetryRecordLoop(loopCycles);
 
-  // Handle I2C Polling for encoders keypresses and encoder key press
-  handleI2c();
+  yield(); // Let the Teensy do background tasks
+}
+
+//================================
+// TASKS
+//================================
+// Motion, touch and keys are critical and run every pass they are due,
+// everything else takes turns one per pass (see Scheduler.h). Budgets are
+// what each should normally need, /metrics counts the runs that took longer.
 
-    
-  // Process touch changes - this function already checks the flag internally
+// Process touch changes - this function already checks the flag internally
+static void touchTask() {
   if (processTouchChanges()) {
     updateBrightnessOnFaderTouchChange();
     printFaderTouchStates();
   }
+}
 
-  // Check for web requests
-  pollWebServer();
-  
+// Send everything queued for OSC this pass as one bundle
+static void oscFlushTask() {
+  flushOscOutput();
+}
+
+static void housekeepingTask() {
+  // Network reset check exiry
+  if (checkForReset && (millis() - resetCheckStartTime > 10000)) {
+    checkForReset = false;
+    debugPrint("[RESET] Reset check window expired.");
+  }
 
   // Handle touch sensor errors
   if (hasTouchError()) {
-    debugPrint(getLastTouchError().c_str());
+    debugPrint(getLastTouchError());
     clearTouchError();
   }
-  
-    // Update NeoPixels
-  updateNeoPixels();
-
-  
-  checkSerialForReboot();
+}
 
-  yield(); // Let the Teensy do background tasks
+static void setupTasks() {
+  //      name            function              period us  priority       budget us
+  addTask("osc_receive",  handleOscMessage,     0,         TASK_CRITICAL, 1000);
+  addTask("faders",       handleFaders,         0,         TASK_CRITICAL, 500);
+  addTask("calibration",  serviceCalibration,   0,         TASK_CRITICAL, 200);
+  addTask("touch",        touchTask,            0,         TASK_CRITICAL, 500);
+  addTask("keys",         handleI2c,            0,         TASK_CRITICAL, 1000);     // One slave per call, a cycle every 10 ms
+  addTask("osc_flush",    oscFlushTask,         0,         TASK_CRITICAL, 500);      // Last, so the pass goes out as one bundle
+  addTask("web",          pollWebServer,        1000,      TASK_NORMAL,   1000);
+  addTask("leds",         updateNeoPixels,      16000,     TASK_NORMAL,   1500);     // ~60 Hz is plenty for fades
+  addTask("serial",       checkSerialForReboot, 10000,     TASK_LOW,      200);
+  addTask("housekeeping", housekeepingTask,     100000,    TASK_LOW,      500);
+  addTask("oled",         updateMetricsDisplay, 100000,    TASK_LOW,      30000);    // A full frame over I2C
 }
 
 void displayIPAddress(){
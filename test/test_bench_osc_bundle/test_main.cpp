@@ -0,0 +1,107 @@
+// test_bench_osc_bundle - nested #bundle decode rate (pio test -e native -f test_bench_osc_bundle -v)
+
+#include <unity.h>
+#include <stdio.h>
+#include "Config.h"
+#include "FaderControl.h"
+#include "NetworkOSC.h"
+#include "OSCWriter.h"
+#include "Metrics.h"
+
+//================================
+// BENCHMARK CONFIGURATION
+//================================
+
+#define BENCH_INNER_BUNDLES   4      // Immediate bundles nested in the outer one
+#define BENCH_INNER_MESSAGES  8      // /PageN/FaderN messages per inner bundle
+#define BENCH_ITERATIONS      20000  // Outer bundles decoded per run
+
+//================================
+// HELPERS
+//================================
+
+struct BenchBundle {
+  uint8_t data[1024];
+  int size;
+};
+
+static void bundleBegin(BenchBundle &b) {
+  OscWriter w(b.data, sizeof(b.data));
+  w.beginBundle(OSC_TIMETAG_IMMEDIATE);
+  b.size = w.size();
+}
+
+static void bundleAdd(BenchBundle &b, const uint8_t *element, int size) {
+  b.data[b.size++] = (size >> 24) & 0xFF;
+  b.data[b.size++] = (size >> 16) & 0xFF;
+  b.data[b.size++] = (size >> 8) & 0xFF;
+  b.data[b.size++] = size & 0xFF;
+  memcpy(b.data + b.size, element, size);
+  b.size += size;
+}
+
+static void bundleAddFader(BenchBundle &b, int faderId, int value) {
+  uint8_t buffer[64];
+  char address[32];
+  snprintf(address, sizeof(address), "/Page1/Fader%d", faderId);
+  OscWriter w(buffer, sizeof(buffer));
+  w.beginMessage(address, ",i");
+  w.addInt(value);
+  w.endMessage();
+  bundleAdd(b, w.data(), w.size());
+}
+
+void setUp() {
+  debugMode = false;   // Serial output would dominate the timing
+  initializeFaders();
+  Fconfig.targetTolerance = TARGET_TOLERANCE;
+  setupOscRoutes();
+  setCurrentOscPage(1);
+}
+
+void tearDown() {
+}
+
+//================================
+// BENCHMARKS
+//================================
+
+void bench_nested_bundle_decode() {
+  BenchBundle inner, outer;
+  bundleBegin(outer);
+  for (int b = 0; b < BENCH_INNER_BUNDLES; b++) {
+    bundleBegin(inner);
+    for (int m = 0; m < BENCH_INNER_MESSAGES; m++) {
+      int index = (b * BENCH_INNER_MESSAGES + m) % NUM_FADERS;
+      bundleAddFader(inner, faders[index].oscID, m * 10);
+    }
+    bundleAdd(outer, inner.data, inner.size);
+  }
+
+  uint32_t bundleErrors = netMetrics.bundleErrors;
+  uint32_t unknown = netMetrics.unknownAddress;
+
+  unsigned long start = micros();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    handleOscBundle(outer.data, outer.size);
+  }
+  unsigned long elapsed = micros() - start;
+  applyPendingSetpoints();
+
+  // Every message has to decode and route or the rate means nothing
+  TEST_ASSERT_EQUAL_UINT32(bundleErrors, netMetrics.bundleErrors);
+  TEST_ASSERT_EQUAL_UINT32(unknown, netMetrics.unknownAddress);
+
+  double messages = (double)BENCH_ITERATIONS * BENCH_INNER_BUNDLES * BENCH_INNER_MESSAGES;
+  double seconds = elapsed > 0 ? elapsed / 1e6 : 1e-6;
+  printf("Bundle decode: %d bytes, %d messages in %d nested bundles\n",
+         outer.size, BENCH_INNER_BUNDLES * BENCH_INNER_MESSAGES, BENCH_INNER_BUNDLES);
+  printf("Bundle decode: %.0f messages in %.3f s = %.0f msg/s (%.3f us/msg)\n",
+         messages, seconds, messages / seconds, elapsed / messages);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(bench_nested_bundle_decode);
+  return UNITY_END();
+}
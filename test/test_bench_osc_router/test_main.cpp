@@ -0,0 +1,121 @@
+// test_bench_osc_router - route trie vs the old strstr/sscanf chain (pio test -e native -f test_bench_osc_router -v)
+
+#include <unity.h>
+#include <stdio.h>
+#include "NetworkOSC.h"
+#include "OSCRouter.h"
+
+//================================
+// BENCHMARK CONFIGURATION
+//================================
+
+#define BENCH_ITERATIONS 200000   // Passes over the address mix per router
+
+// Weighted like console traffic: mostly fader moves, some bulk updates,
+// page changes, colours and addresses nothing handles
+static const char *const benchAddresses[] = {
+  "/Page1/Fader201", "/Page1/Fader202", "/Page1/Fader203", "/Page1/Fader204",
+  "/Page1/Fader205", "/Page1/Fader206", "/Page1/Fader207", "/Page1/Fader208",
+  "/Page2/Fader201", "/Page2/Fader210", "/Page12/Fader105", "/Page12/Fader110",
+  "/faderUpdate", "/faderUpdate", "/faderDelta", "/faderSync",
+  "/updatePage/current", "/Page1/faderUpdate",
+  "/Color201", "/Page1/Color205",
+  "/Page1/Button101", "/Executor/Knob401",
+};
+#define BENCH_ADDRESS_COUNT (int)(sizeof(benchAddresses) / sizeof(benchAddresses[0]))
+
+//================================
+// LEGACY DISPATCH
+//================================
+// The if/else chain the router replaced, resolving to a route number and
+// the same integers the handlers used to pull out of the address
+
+enum LegacyRoute {
+  LEGACY_NONE,
+  LEGACY_FADER_UPDATE,
+  LEGACY_FADER_DELTA,
+  LEGACY_FADER_SYNC,
+  LEGACY_PAGE_UPDATE,
+  LEGACY_COLOR,
+  LEGACY_FADER_MOVEMENT
+};
+
+static LegacyRoute legacyLookup(const char *addr, int &first, int &second) {
+  if (strstr(addr, "/faderUpdate") != NULL) {
+    return LEGACY_FADER_UPDATE;
+  } else if (strstr(addr, "/faderDelta") != NULL) {
+    return LEGACY_FADER_DELTA;
+  } else if (strstr(addr, "/faderSync") != NULL) {
+    return LEGACY_FADER_SYNC;
+  } else if (strstr(addr, "/updatePage/current") != NULL) {
+    return LEGACY_PAGE_UPDATE;
+  } else if (strstr(addr, "/Color") != NULL) {
+    const char *colorPos = strstr(addr, "Color");
+    first = atoi(colorPos + 5);
+    return LEGACY_COLOR;
+  } else if (strstr(addr, "/Page") != NULL && strstr(addr, "/Fader") != NULL) {
+    if (sscanf(addr, "/Page%d/Fader%d", &first, &second) == 2) {
+      return LEGACY_FADER_MOVEMENT;
+    }
+  }
+  return LEGACY_NONE;
+}
+
+void setUp() {
+  setupOscRoutes();
+}
+
+void tearDown() {
+}
+
+//================================
+// BENCHMARKS
+//================================
+
+void bench_router_against_legacy_chain() {
+  // Both have to agree on the mix before their timings are comparable
+  for (int a = 0; a < BENCH_ADDRESS_COUNT; a++) {
+    int first = 0, second = 0;
+    OscRouteMatch match;
+    LegacyRoute legacy = legacyLookup(benchAddresses[a], first, second);
+    OscRouteHandler handler = oscRouterLookup(benchAddresses[a], match);
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(legacy != LEGACY_NONE, handler != nullptr, benchAddresses[a]);
+    if (match.count > 0) TEST_ASSERT_EQUAL_INT(first, match.captures[0]);
+    if (match.count > 1) TEST_ASSERT_EQUAL_INT(second, match.captures[1]);
+  }
+
+  // Sums keep the optimiser from dropping either loop
+  volatile long legacySum = 0;
+  volatile long routerSum = 0;
+
+  unsigned long start = micros();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    for (int a = 0; a < BENCH_ADDRESS_COUNT; a++) {
+      int first = 0, second = 0;
+      legacySum += legacyLookup(benchAddresses[a], first, second) + first + second;
+    }
+  }
+  unsigned long legacyUs = micros() - start;
+
+  start = micros();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    for (int a = 0; a < BENCH_ADDRESS_COUNT; a++) {
+      OscRouteMatch match;
+      routerSum += (oscRouterLookup(benchAddresses[a], match) != nullptr) + match.count;
+    }
+  }
+  unsigned long routerUs = micros() - start;
+
+  double lookups = (double)BENCH_ITERATIONS * BENCH_ADDRESS_COUNT;
+  printf("Router benchmark: %d addresses x %d passes\n", BENCH_ADDRESS_COUNT, BENCH_ITERATIONS);
+  printf("  strstr/sscanf chain: %8.1f ns/lookup\n", legacyUs * 1000.0 / lookups);
+  printf("  route trie:          %8.1f ns/lookup\n", routerUs * 1000.0 / lookups);
+  printf("  speedup:             %8.2fx\n", routerUs > 0 ? (double)legacyUs / routerUs : 0.0);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(bench_router_against_legacy_chain);
+  return UNITY_END();
+}
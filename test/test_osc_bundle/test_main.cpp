@@ -0,0 +1,157 @@
+// test_osc_bundle - #bundle decoding and timetag scheduling (pio test -e native)
+
+#include <unity.h>
+#include "Config.h"
+#include "FaderControl.h"
+#include "NetworkOSC.h"
+#include "OSCWriter.h"
+#include "Metrics.h"
+
+//================================
+// HELPERS
+//================================
+
+// Fixed console clock, the first stamped bundle becomes "now"
+static const uint64_t T0 = 3900000000ULL << 32;
+static uint64_t afterMs(uint64_t timetag, long ms) {
+  return timetag + (uint64_t)((int64_t)ms * 4294967LL);   // 2^32 / 1000 per ms
+}
+
+// Bundle built by hand so elements can be other bundles
+struct TestBundle {
+  uint8_t data[512];
+  int size;
+};
+
+static void bundleBegin(TestBundle &b, uint64_t timetag) {
+  OscWriter w(b.data, sizeof(b.data));
+  w.beginBundle(timetag);
+  b.size = w.size();
+}
+
+static void bundleAdd(TestBundle &b, const uint8_t *element, int size) {
+  b.data[b.size++] = (size >> 24) & 0xFF;
+  b.data[b.size++] = (size >> 16) & 0xFF;
+  b.data[b.size++] = (size >> 8) & 0xFF;
+  b.data[b.size++] = size & 0xFF;
+  memcpy(b.data + b.size, element, size);
+  b.size += size;
+}
+
+static void bundleAddFader(TestBundle &b, int faderId, int value) {
+  uint8_t buffer[64];
+  char address[32];
+  snprintf(address, sizeof(address), "/Page1/Fader%d", faderId);
+  OscWriter w(buffer, sizeof(buffer));
+  w.beginMessage(address, ",i");
+  w.addInt(value);
+  w.endMessage();
+  bundleAdd(b, w.data(), w.size());
+}
+
+static int setpointOf(int faderId) {
+  return (int)faders[getFaderIndexFromID(faderId)].setpoint;
+}
+
+void setUp() {
+  initializeFaders();
+  Fconfig.targetTolerance = TARGET_TOLERANCE;
+  setupOscRoutes();
+  setCurrentOscPage(1);
+}
+
+void tearDown() {
+}
+
+//================================
+// TESTS
+//================================
+
+void test_immediate_bundle_applies_every_message() {
+  TestBundle b;
+  bundleBegin(b, OSC_TIMETAG_IMMEDIATE);
+  bundleAddFader(b, 201, 10);
+  bundleAddFader(b, 202, 20);
+
+  handleOscBundle(b.data, b.size);
+  applyPendingSetpoints();
+
+  TEST_ASSERT_EQUAL_INT(10, setpointOf(201));
+  TEST_ASSERT_EQUAL_INT(20, setpointOf(202));
+}
+
+void test_nested_bundles_follow_their_own_timetags() {
+  TestBundle anchor, future, past, outer;
+
+  // First stamped bundle anchors the sender clock and is due now
+  bundleBegin(anchor, T0);
+  bundleAddFader(anchor, 203, 30);
+
+  bundleBegin(future, afterMs(T0, 100));
+  bundleAddFader(future, 204, 40);
+
+  bundleBegin(past, afterMs(T0, -1000));
+  bundleAddFader(past, 205, 50);
+
+  bundleBegin(outer, OSC_TIMETAG_IMMEDIATE);
+  bundleAddFader(outer, 206, 60);
+  bundleAdd(outer, anchor.data, anchor.size);
+  bundleAdd(outer, future.data, future.size);
+  bundleAdd(outer, past.data, past.size);
+
+  handleOscBundle(outer.data, outer.size);
+  serviceOscSchedule();
+  applyPendingSetpoints();
+
+  TEST_ASSERT_EQUAL_INT(60, setpointOf(206));
+  TEST_ASSERT_EQUAL_INT(30, setpointOf(203));
+  TEST_ASSERT_EQUAL_INT(50, setpointOf(205));   // Already late, applied at once
+  TEST_ASSERT_EQUAL_INT(0, setpointOf(204));    // Held for 100 ms
+
+  delay(150);
+  serviceOscSchedule();
+  applyPendingSetpoints();
+  TEST_ASSERT_EQUAL_INT(40, setpointOf(204));
+}
+
+void test_bad_element_size_is_counted_and_stops_decoding() {
+  TestBundle b;
+  bundleBegin(b, OSC_TIMETAG_IMMEDIATE);
+  bundleAddFader(b, 207, 70);
+  bundleAddFader(b, 208, 80);
+  b.data[b.size - 28] = 0x7F;   // Second element claims more than the packet holds
+
+  uint32_t errors = netMetrics.bundleErrors;
+  handleOscBundle(b.data, b.size);
+  applyPendingSetpoints();
+
+  TEST_ASSERT_EQUAL_INT(70, setpointOf(207));
+  TEST_ASSERT_EQUAL_INT(0, setpointOf(208));
+  TEST_ASSERT_EQUAL_UINT32(errors + 1, netMetrics.bundleErrors);
+}
+
+void test_nesting_deeper_than_the_limit_is_dropped() {
+  TestBundle b[OSC_BUNDLE_MAX_DEPTH + 1];
+  bundleBegin(b[0], OSC_TIMETAG_IMMEDIATE);
+  bundleAddFader(b[0], 209, 90);
+  for (int i = 1; i <= OSC_BUNDLE_MAX_DEPTH; i++) {
+    bundleBegin(b[i], OSC_TIMETAG_IMMEDIATE);
+    bundleAdd(b[i], b[i - 1].data, b[i - 1].size);
+  }
+
+  uint32_t errors = netMetrics.bundleErrors;
+  handleOscBundle(b[OSC_BUNDLE_MAX_DEPTH].data, b[OSC_BUNDLE_MAX_DEPTH].size);
+  applyPendingSetpoints();
+
+  TEST_ASSERT_EQUAL_INT(0, setpointOf(209));
+  TEST_ASSERT_EQUAL_UINT32(errors + 1, netMetrics.bundleErrors);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_immediate_bundle_applies_every_message);
+  RUN_TEST(test_nested_bundles_follow_their_own_timetags);
+  RUN_TEST(test_bad_element_size_is_counted_and_stops_decoding);
+  RUN_TEST(test_nesting_deeper_than_the_limit_is_dropped);
+  return UNITY_END();
+}
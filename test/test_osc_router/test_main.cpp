@@ -0,0 +1,151 @@
+// test_osc_router - address trie matching and '#' captures (pio test -e native)
+
+#include <unity.h>
+#include "OSCRouter.h"
+#include "NetworkOSC.h"
+
+//================================
+// HELPERS
+//================================
+
+// Distinct handlers so a lookup tells which route won
+static void routeA(LiteOSCParser &, const OscRouteMatch &) {}
+static void routeB(LiteOSCParser &, const OscRouteMatch &) {}
+static void routeC(LiteOSCParser &, const OscRouteMatch &) {}
+
+void setUp() {
+  oscRouterClear();
+}
+
+void tearDown() {
+}
+
+//================================
+// TESTS
+//================================
+
+void test_literal_routes_match_exactly() {
+  TEST_ASSERT_TRUE(oscRouterAdd("/faderUpdate", routeA));
+  TEST_ASSERT_TRUE(oscRouterAdd("/updatePage/current", routeB));
+
+  OscRouteMatch match;
+  TEST_ASSERT_EQUAL_PTR(routeA, oscRouterLookup("/faderUpdate", match));
+  TEST_ASSERT_EQUAL_INT(0, match.count);
+  TEST_ASSERT_EQUAL_PTR(routeB, oscRouterLookup("/updatePage/current", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/faderUpdat", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/faderUpdate/extra", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/updatePage", match));
+  TEST_ASSERT_NULL(oscRouterLookup("faderUpdate", match));
+}
+
+void test_hash_captures_integers_in_pattern_order() {
+  oscRouterAdd("/Page#/Fader#", routeA);
+
+  OscRouteMatch match;
+  TEST_ASSERT_EQUAL_PTR(routeA, oscRouterLookup("/Page12/Fader207", match));
+  TEST_ASSERT_EQUAL_INT(2, match.count);
+  TEST_ASSERT_EQUAL_INT(12, match.captures[0]);
+  TEST_ASSERT_EQUAL_INT(207, match.captures[1]);
+}
+
+void test_hash_needs_at_least_one_digit() {
+  oscRouterAdd("/Page#/Fader#", routeA);
+
+  OscRouteMatch match;
+  TEST_ASSERT_NULL(oscRouterLookup("/Page/Fader201", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/Page1/Fader", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/Page1x/Fader201", match));
+}
+
+void test_hash_overflow_fails_the_match() {
+  oscRouterAdd("/Color#", routeA);
+
+  OscRouteMatch match;
+  TEST_ASSERT_EQUAL_PTR(routeA, oscRouterLookup("/Color2147483647", match));
+  TEST_ASSERT_EQUAL_INT(2147483647, match.captures[0]);
+  TEST_ASSERT_NULL(oscRouterLookup("/Color2147483648", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/Color99999999999999999999", match));
+}
+
+void test_literal_wins_over_wildcard_and_backtracks() {
+  oscRouterAdd("/*/Color#", routeA);
+  oscRouterAdd("/Page#/Fader#", routeB);
+  oscRouterAdd("/Page1/Fader201", routeC);
+
+  OscRouteMatch match;
+  TEST_ASSERT_EQUAL_PTR(routeC, oscRouterLookup("/Page1/Fader201", match));
+  TEST_ASSERT_EQUAL_INT(0, match.count);
+
+  // Literal branch dead-ends, the wildcard one takes over with clean captures
+  TEST_ASSERT_EQUAL_PTR(routeB, oscRouterLookup("/Page1/Fader202", match));
+  TEST_ASSERT_EQUAL_INT(2, match.count);
+  TEST_ASSERT_EQUAL_INT(1, match.captures[0]);
+  TEST_ASSERT_EQUAL_INT(202, match.captures[1]);
+
+  TEST_ASSERT_EQUAL_PTR(routeA, oscRouterLookup("/Page3/Color205", match));
+  TEST_ASSERT_EQUAL_INT(1, match.count);
+  TEST_ASSERT_EQUAL_INT(205, match.captures[0]);
+}
+
+void test_question_mark_and_star_stay_inside_a_segment() {
+  oscRouterAdd("/Fader?", routeA);
+  oscRouterAdd("/Exec*Knob#", routeB);
+
+  OscRouteMatch match;
+  TEST_ASSERT_EQUAL_PTR(routeA, oscRouterLookup("/Fader7", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/Fader", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/Fader12", match));
+
+  TEST_ASSERT_EQUAL_PTR(routeB, oscRouterLookup("/ExecutorKnob401", match));
+  TEST_ASSERT_EQUAL_INT(401, match.captures[0]);
+  TEST_ASSERT_NULL(oscRouterLookup("/Exec/Knob401", match));
+}
+
+void test_too_many_captures_do_not_match() {
+  oscRouterAdd("/#/#/#/#/#", routeA);
+
+  OscRouteMatch match;
+  TEST_ASSERT_NULL(oscRouterLookup("/1/2/3/4/5", match));
+}
+
+void test_console_routes_accept_one_prefix_segment() {
+  setupOscRoutes();
+
+  OscRouteMatch match;
+  OscRouteHandler faderUpdate = oscRouterLookup("/faderUpdate", match);
+  OscRouteHandler pageUpdate = oscRouterLookup("/updatePage/current", match);
+  TEST_ASSERT_NOT_NULL(faderUpdate);
+  TEST_ASSERT_NOT_NULL(pageUpdate);
+
+  TEST_ASSERT_EQUAL_PTR(faderUpdate, oscRouterLookup("/Page1/faderUpdate", match));
+  TEST_ASSERT_EQUAL_PTR(pageUpdate, oscRouterLookup("/Page1/updatePage/current", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/a/b/faderUpdate", match));
+
+  // Prefix branch must not shadow fader moves on the same first segment
+  OscRouteHandler movement = oscRouterLookup("/Page1/Fader201", match);
+  TEST_ASSERT_NOT_NULL(movement);
+  TEST_ASSERT_TRUE(movement != faderUpdate);
+}
+
+void test_incoming_pattern_characters_are_not_expanded() {
+  setupOscRoutes();
+
+  OscRouteMatch match;
+  TEST_ASSERT_NULL(oscRouterLookup("/Page1/Fader20[1-5]", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/Page*/Fader201", match));
+  TEST_ASSERT_NULL(oscRouterLookup("/Page1/Fader{201,202}", match));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_literal_routes_match_exactly);
+  RUN_TEST(test_hash_captures_integers_in_pattern_order);
+  RUN_TEST(test_hash_needs_at_least_one_digit);
+  RUN_TEST(test_hash_overflow_fails_the_match);
+  RUN_TEST(test_literal_wins_over_wildcard_and_backtracks);
+  RUN_TEST(test_question_mark_and_star_stay_inside_a_segment);
+  RUN_TEST(test_too_many_captures_do_not_match);
+  RUN_TEST(test_console_routes_accept_one_prefix_segment);
+  RUN_TEST(test_incoming_pattern_characters_are_not_expanded);
+  return UNITY_END();
+}
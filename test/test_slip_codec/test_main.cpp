@@ -0,0 +1,180 @@
+// test_slip_codec - SLIP framing for OSC over TCP (pio test -e native)
+
+#include <unity.h>
+#include <stdlib.h>
+#include "SlipCodec.h"
+
+//================================
+// HELPERS
+//================================
+
+static uint8_t frame[64];
+static SlipDecoder decoder(frame, sizeof(frame));
+
+// Feed a byte stream, returns how many frames completed (the last one stays in frame)
+static int feedAll(const uint8_t *data, size_t size) {
+  int frames = 0;
+  for (size_t i = 0; i < size; i++) {
+    if (decoder.feed(data[i])) frames++;
+  }
+  return frames;
+}
+
+void setUp() {
+  decoder.reset();
+}
+
+void tearDown() {
+}
+
+//================================
+// TESTS
+//================================
+
+void test_round_trip_escapes_end_and_esc() {
+  const uint8_t packet[] = { 0x01, SLIP_END, 0x02, SLIP_ESC, SLIP_ESC_END, SLIP_END, SLIP_ESC };
+  const uint8_t expected[] = {
+    SLIP_END, 0x01, SLIP_ESC, SLIP_ESC_END, 0x02, SLIP_ESC, SLIP_ESC_ESC, SLIP_ESC_END,
+    SLIP_ESC, SLIP_ESC_END, SLIP_ESC, SLIP_ESC_ESC, SLIP_END
+  };
+
+  uint8_t encoded[SLIP_ENCODED_MAX(sizeof(packet))];
+  size_t size = slipEncode(packet, sizeof(packet), encoded, sizeof(encoded));
+  TEST_ASSERT_EQUAL_UINT(sizeof(expected), size);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, encoded, size);
+
+  TEST_ASSERT_EQUAL_INT(1, feedAll(encoded, size));
+  TEST_ASSERT_EQUAL_UINT(sizeof(packet), decoder.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(packet, decoder.data(), sizeof(packet));
+}
+
+void test_encode_fails_when_output_is_too_small() {
+  const uint8_t packet[] = { SLIP_END, SLIP_END, SLIP_END };
+  uint8_t encoded[SLIP_ENCODED_MAX(sizeof(packet))];
+
+  TEST_ASSERT_EQUAL_UINT(sizeof(encoded), slipEncode(packet, sizeof(packet), encoded, sizeof(encoded)));
+  TEST_ASSERT_EQUAL_UINT(0, slipEncode(packet, sizeof(packet), encoded, sizeof(encoded) - 1));
+  TEST_ASSERT_EQUAL_UINT(0, slipEncode(packet, 0, encoded, 1));
+}
+
+void test_back_to_back_frames_and_empty_frames() {
+  const uint8_t stream[] = { SLIP_END, SLIP_END, 'a', 'b', SLIP_END, SLIP_END, SLIP_END, 'c', SLIP_END };
+
+  int frames = 0;
+  for (size_t i = 0; i < sizeof(stream); i++) {
+    if (!decoder.feed(stream[i])) continue;
+    frames++;
+    if (frames == 1) {
+      TEST_ASSERT_EQUAL_UINT(2, decoder.size());
+      TEST_ASSERT_EQUAL_UINT8_ARRAY("ab", decoder.data(), 2);
+    }
+  }
+  TEST_ASSERT_EQUAL_INT(2, frames);
+  TEST_ASSERT_EQUAL_UINT(1, decoder.size());
+  TEST_ASSERT_EQUAL_INT('c', decoder.data()[0]);
+}
+
+void test_oversized_frame_is_dropped_up_to_the_next_end() {
+  uint8_t stream[sizeof(frame) + 8];
+  size_t n = 0;
+  stream[n++] = SLIP_END;
+  for (size_t i = 0; i <= sizeof(frame); i++) stream[n++] = 'x';
+  stream[n++] = SLIP_END;
+  stream[n++] = 'o';
+  stream[n++] = 'k';
+  stream[n++] = SLIP_END;
+
+  uint32_t dropped = decoder.droppedFrames();
+  TEST_ASSERT_EQUAL_INT(1, feedAll(stream, n));
+  TEST_ASSERT_EQUAL_UINT32(dropped + 1, decoder.droppedFrames());
+  TEST_ASSERT_EQUAL_UINT(2, decoder.size());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY("ok", decoder.data(), 2);
+}
+
+void test_frame_filling_the_buffer_exactly_is_kept() {
+  uint8_t packet[sizeof(frame)];
+  for (size_t i = 0; i < sizeof(packet); i++) packet[i] = (i % 2) ? SLIP_END : (uint8_t)i;
+
+  uint8_t encoded[SLIP_ENCODED_MAX(sizeof(packet))];
+  size_t size = slipEncode(packet, sizeof(packet), encoded, sizeof(encoded));
+  TEST_ASSERT_TRUE(size > 0);
+
+  uint32_t dropped = decoder.droppedFrames();
+  TEST_ASSERT_EQUAL_INT(1, feedAll(encoded, size));
+  TEST_ASSERT_EQUAL_UINT32(dropped, decoder.droppedFrames());
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(packet, decoder.data(), sizeof(packet));
+}
+
+// Thousands of random packets, a quarter of the bytes END or ESC and some
+// too large for the decoder, encoded back to back into one stream
+#define STRESS_FRAMES    5000
+#define STRESS_MAX_SIZE  300
+#define STRESS_DECODER   256
+
+static uint32_t stressRandom = 0x12345678;
+static uint32_t nextRandom() {
+  stressRandom ^= stressRandom << 13;
+  stressRandom ^= stressRandom >> 17;
+  stressRandom ^= stressRandom << 5;
+  return stressRandom;
+}
+
+static uint8_t randomByte() {
+  switch (nextRandom() % 8) {
+    case 0:  return SLIP_END;
+    case 1:  return SLIP_ESC;
+    default: return (uint8_t)nextRandom();
+  }
+}
+
+void test_stress_random_frames_round_trip() {
+  static uint8_t packets[STRESS_FRAMES][STRESS_MAX_SIZE];
+  static uint16_t sizes[STRESS_FRAMES];
+  size_t capacity = (size_t)STRESS_FRAMES * SLIP_ENCODED_MAX(STRESS_MAX_SIZE);
+  uint8_t *stream = (uint8_t *)malloc(capacity);
+  TEST_ASSERT_NOT_NULL(stream);
+
+  size_t streamSize = 0;
+  int oversized = 0;
+  for (int f = 0; f < STRESS_FRAMES; f++) {
+    sizes[f] = 1 + nextRandom() % STRESS_MAX_SIZE;
+    for (int i = 0; i < sizes[f]; i++) packets[f][i] = randomByte();
+    if (sizes[f] > STRESS_DECODER) oversized++;
+
+    size_t encoded = slipEncode(packets[f], sizes[f], stream + streamSize, capacity - streamSize);
+    TEST_ASSERT_TRUE(encoded > 0);
+    streamSize += encoded;
+  }
+
+  uint8_t buffer[STRESS_DECODER];
+  SlipDecoder stressDecoder(buffer, sizeof(buffer));
+  int next = 0;   // Packet the next completed frame must equal
+  int frames = 0;
+
+  for (size_t i = 0; i < streamSize; i++) {
+    if (!stressDecoder.feed(stream[i])) continue;
+
+    while (next < STRESS_FRAMES && sizes[next] > STRESS_DECODER) next++;   // Dropped ones
+    TEST_ASSERT_TRUE(next < STRESS_FRAMES);
+    TEST_ASSERT_EQUAL_UINT(sizes[next], stressDecoder.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(packets[next], stressDecoder.data(), sizes[next]);
+    next++;
+    frames++;
+  }
+  free(stream);
+
+  TEST_ASSERT_TRUE(oversized > 0);
+  TEST_ASSERT_EQUAL_INT(STRESS_FRAMES - oversized, frames);
+  TEST_ASSERT_EQUAL_UINT32(oversized, stressDecoder.droppedFrames());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip_escapes_end_and_esc);
+  RUN_TEST(test_encode_fails_when_output_is_too_small);
+  RUN_TEST(test_back_to_back_frames_and_empty_frames);
+  RUN_TEST(test_oversized_frame_is_dropped_up_to_the_next_end);
+  RUN_TEST(test_frame_filling_the_buffer_exactly_is_kept);
+  RUN_TEST(test_stress_random_frames_round_trip);
+  return UNITY_END();
+}
@@ -0,0 +1,95 @@
+"""Build the web UI in web/ into gzipped blobs in flash (src/WebAssets.cpp).
+
+Runs before every PlatformIO build (extra_scripts = pre:...) and only
+regenerates when a file in web/ changed. Can also be run by hand:
+
+    python tools/build_web_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+
+# -------------------- CONFIG --------------------
+# URL path, file in web/, content type
+ASSETS = [
+    ("/",               "index.html",  "text/html"),
+    ("/osc_settings",   "osc.html",    "text/html"),
+    ("/fader_settings", "faders.html", "text/html"),
+    ("/stats",          "stats.html",  "text/html"),
+    ("/live",           "live.html",   "text/html"),
+    ("/style.css",      "style.css",   "text/css"),
+    ("/app.js",         "app.js",      "application/javascript"),
+]
+
+# Pages revalidate every time (cheap 304), CSS and JS are reused for a while
+CACHE_CONTROL = {
+    "text/html": "no-cache",
+}
+DEFAULT_CACHE_CONTROL = "max-age=3600"
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "WebAssets.cpp")
+
+
+def identifier(name):
+    return "asset_" + "".join(c if c.isalnum() else "_" for c in name)
+
+
+def up_to_date():
+    if not os.path.exists(OUTPUT):
+        return False
+    built = os.path.getmtime(OUTPUT)
+    sources = [os.path.join(WEB_DIR, f) for _, f, _ in ASSETS]
+    return all(os.path.getmtime(s) <= built for s in sources)
+
+
+def build():
+    lines = [
+        "// WebAssets.cpp - GENERATED by tools/build_web_assets.py from web/, do not edit",
+        "",
+        '#include "WebAssets.h"',
+        "",
+    ]
+    entries = []
+    total = 0
+
+    for path, filename, content_type in ASSETS:
+        with open(os.path.join(WEB_DIR, filename), "rb") as f:
+            raw = f.read()
+        # mtime=0 keeps the output (and the ETag) identical between builds
+        packed = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = '\\"' + hashlib.sha1(packed).hexdigest()[:16] + '\\"'
+        name = identifier(filename)
+        total += len(packed)
+
+        lines.append(f"// {filename}: {len(raw)} bytes, {len(packed)} gzipped")
+        lines.append(f"static const uint8_t {name}[] PROGMEM = {{")
+        for i in range(0, len(packed), 16):
+            lines.append("  " + ", ".join(f"0x{b:02x}" for b in packed[i:i + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+
+        cache = CACHE_CONTROL.get(content_type, DEFAULT_CACHE_CONTROL)
+        entries.append(f'  {{ "{path}", "{content_type}", "{cache}", "{etag}", {name}, sizeof({name}) }},')
+
+    lines.append("const WebAsset webAssets[] = {")
+    lines.extend(entries)
+    lines.append("};")
+    lines.append("")
+    lines.append("const size_t webAssetCount = sizeof(webAssets) / sizeof(webAssets[0]);")
+    lines.append("")
+
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write("\n".join(lines))
+    print(f"[WEB] Built {len(ASSETS)} web assets, {total} bytes gzipped -> {os.path.relpath(OUTPUT, PROJECT_DIR)}")
+
+
+if not up_to_date():
+    build()
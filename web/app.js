@@ -0,0 +1,108 @@
+// app.js - fills the static pages with the live values from /state.json
+
+function row(cells) {
+  return '<tr><td>' + cells.join('</td><td>') + '</td></tr>';
+}
+
+function fillForms(values) {
+  document.querySelectorAll('input[name], select[name]').forEach(function (el) {
+    if (el.type === 'hidden' || !(el.name in values)) return;
+    if (el.type === 'checkbox') el.checked = !!values[el.name];
+    else el.value = values[el.name];
+  });
+}
+
+function fillText(state) {
+  document.querySelectorAll('[data-value]').forEach(function (el) {
+    var value = state[el.dataset.value];
+    if (value !== undefined) el.textContent = value;
+  });
+}
+
+// One row of inputs per extra OSC destination, filled by fillForms()
+function buildDestinationRows(count) {
+  var body = document.getElementById('dest-table');
+  if (!body) return;
+  var html = '';
+  for (var d = 0; d < count; d++) {
+    html += row([
+      "<input type='checkbox' name='dest" + d + "_en' value='1'>",
+      "<input type='text' name='dest" + d + "_ip'>",
+      "<input type='number' name='dest" + d + "_port' min='1' max='65535'>",
+      "<input type='checkbox' name='dest" + d + "_bc' value='1'>",
+      "<input type='checkbox' name='dest" + d + "_tcp' value='1'>"
+    ]);
+  }
+  body.innerHTML = html;
+}
+
+function fillTable(id, rows) {
+  var body = document.getElementById(id);
+  if (body) body.innerHTML = rows.map(row).join('');
+}
+
+function fillLatency(histograms) {
+  var box = document.getElementById('latency');
+  if (!box) return;
+  var html = '';
+  histograms.forEach(function (h) {
+    var rows = [
+      ['Samples', h.count],
+      ['Min / Avg / Max', h.min + ' / ' + h.avg + ' / ' + h.max + ' us'],
+      ['50% under', h.p50 + ' us'],
+      ['99% under', h.p99 + ' us']
+    ];
+    h.buckets.forEach(function (b, i) {
+      if (b[1] === 0) return;
+      var label = b[0] ? '&lt; ' + b[0] + ' us' : '&ge; ' + h.buckets[i - 1][0] + ' us';
+      rows.push([label, b[1]]);
+    });
+    html += '<h3>' + h.name + '</h3><table>' + rows.map(row).join('') + '</table>';
+  });
+  box.innerHTML = html;
+}
+
+// Calibration runs in the background, poll its status while it does
+function showCalibration(job) {
+  var status = document.getElementById('calibration-status');
+  status.textContent = job.running
+    ? 'fader ' + (job.fader + 1) + ', finding ' + job.phase
+    : job.cancelled ? 'cancelled' : job.finished ? 'done' : 'idle';
+  document.getElementById('calibration-progress').value = job.progress;
+  document.getElementById('calibration-cancel').disabled = !job.running;
+  fillTable('calibration-table', job.faders.map(function (f, i) {
+    return ['Fader ' + (i + 1), f.outcome, f.min, f.max];
+  }));
+  if (job.running) setTimeout(pollCalibration, 500);
+}
+
+function pollCalibration() {
+  fetch('/api/v1/calibration/job', { cache: 'no-store' })
+    .then(function (response) { return response.json(); })
+    .then(showCalibration);
+}
+
+if (document.getElementById('calibration-job')) {
+  document.getElementById('calibration-cancel').onclick = function () {
+    fetch('/api/v1/calibration/job', { method: 'DELETE' })
+      .then(function (response) { return response.json(); })
+      .then(showCalibration);
+  };
+  pollCalibration();
+}
+
+fetch('/state.json', { cache: 'no-store' })
+  .then(function (response) { return response.json(); })
+  .then(function (state) {
+    buildDestinationRows(state.destinationCount);
+    fillForms(state.form);
+    fillText(state);
+    fillTable('dest-stats', state.destinationStats.map(function (d) {
+      return [d.name, d.packets, d.bytes, d.errors];
+    }));
+    fillTable('fader-table', state.faders.map(function (f, i) {
+      return ['Fader ' + (i + 1), f.current, f.min, f.max, f.osc];
+    }));
+    fillTable('osc-table', state.oscOutput);
+    fillLatency(state.latency);
+  });